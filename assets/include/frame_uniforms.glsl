@@ -0,0 +1,7 @@
+layout (std140, row_major, binding = 0) uniform FrameUniforms
+{
+  mat4  uni_CameraProduct;
+  vec2  uni_ViewportSize;
+  float uni_Time;
+  float uni_DeltaTime;
+};
@@ -0,0 +1,70 @@
+// Samples the texture (or texture array layer) a quad's texture index refers to. A plain texture
+// index is a texture slot, with slot 0 meaning no texture. An array texture index holds the
+// texture array's slot in its upper 16 bits and the layer in its lower 16 bits, and is negative
+// for no texture. In multi-draw mode, each draw's table, found at the draw's base instance, maps
+// its DG_TEXTURE_SLOT_COUNT texture slots onto the texture units bound for the multi-draw, of which
+// there are 32 where the graphics card has that many fragment texture units and 16 otherwise, as
+// the renderer also picks.
+
+#if defined(DG_MULTIDRAW)
+  #if DG_FRAGMENT_TEXTURE_UNITS >= 32
+    #define DG_TEXTURE_UNIT_COUNT 32
+  #else
+    #define DG_TEXTURE_UNIT_COUNT 16
+  #endif
+
+  layout (std430, binding = 0) readonly buffer TextureTables2D
+  {
+    int tables[];
+  };
+#else
+  #define DG_TEXTURE_UNIT_COUNT DG_TEXTURE_SLOT_COUNT
+#endif
+
+#if defined(DG_ARRAYS)
+  #define DG_TEXTURES uni_TexArrays
+  uniform sampler2DArray uni_TexArrays[DG_TEXTURE_UNIT_COUNT];
+#else
+  #define DG_TEXTURES uni_TexSlots
+  uniform sampler2D uni_TexSlots[DG_TEXTURE_UNIT_COUNT];
+#endif
+
+#define DG_SAMPLE_UNIT(unit) case unit: return texture(DG_TEXTURES[unit], coords);
+
+vec4 sampleQuadTexture (int texIndex, vec2 texCoords, int tableIndex)
+{
+#if defined(DG_ARRAYS)
+  if (texIndex < 0) { return vec4(1.0); }
+
+  vec3 coords = vec3(texCoords, float(texIndex & 0xFFFF));
+  int slot = texIndex >> 16;
+#else
+  if (texIndex <= 0) { return vec4(1.0); }
+
+  vec2 coords = texCoords;
+  int slot = texIndex;
+#endif
+
+#if defined(DG_MULTIDRAW)
+  int unit = tables[tableIndex * DG_TEXTURE_SLOT_COUNT + slot];
+#else
+  int unit = slot;
+#endif
+
+  // Quads in one draw sample different units, so the unit is not dynamically uniform, and core
+  // GLSL only allows sampler arrays to be indexed by dynamically uniform expressions. Each case
+  // below indexes the array with a constant instead.
+  switch (unit) {
+    DG_SAMPLE_UNIT(0)  DG_SAMPLE_UNIT(1)  DG_SAMPLE_UNIT(2)  DG_SAMPLE_UNIT(3)
+    DG_SAMPLE_UNIT(4)  DG_SAMPLE_UNIT(5)  DG_SAMPLE_UNIT(6)  DG_SAMPLE_UNIT(7)
+    DG_SAMPLE_UNIT(8)  DG_SAMPLE_UNIT(9)  DG_SAMPLE_UNIT(10) DG_SAMPLE_UNIT(11)
+    DG_SAMPLE_UNIT(12) DG_SAMPLE_UNIT(13) DG_SAMPLE_UNIT(14) DG_SAMPLE_UNIT(15)
+#if DG_TEXTURE_UNIT_COUNT > 16
+    DG_SAMPLE_UNIT(16) DG_SAMPLE_UNIT(17) DG_SAMPLE_UNIT(18) DG_SAMPLE_UNIT(19)
+    DG_SAMPLE_UNIT(20) DG_SAMPLE_UNIT(21) DG_SAMPLE_UNIT(22) DG_SAMPLE_UNIT(23)
+    DG_SAMPLE_UNIT(24) DG_SAMPLE_UNIT(25) DG_SAMPLE_UNIT(26) DG_SAMPLE_UNIT(27)
+    DG_SAMPLE_UNIT(28) DG_SAMPLE_UNIT(29) DG_SAMPLE_UNIT(30) DG_SAMPLE_UNIT(31)
+#endif
+    default: return vec4(1.0);
+  }
+}
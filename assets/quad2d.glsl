@@ -1,26 +1,67 @@
 #shader vertex
 #version 450 core
 
-layout (location = 0) in vec3  in_Position;
-layout (location = 1) in vec2  in_TexCoords;
-layout (location = 2) in vec4  in_Color;
-layout (location = 3) in float in_TexIndex;
-layout (location = 4) in float in_EntityId;
+// Permutations:
+//   DG_INSTANCED  - Expands the instanced path's unit quad by each instance's transform.
+//   DG_ARRAYS     - Samples texture array layers rather than whole textures.
+//   DG_MULTIDRAW  - Maps texture slots through the multi-draw's tables, indexed by base instance.
+//   DG_UNTEXTURED - Ignores textures, drawing every quad in its flat color.
+//   DG_ALPHA_TEST - Discards fragments less opaque than DG_ALPHA_CUTOFF (0.5 by default).
 
-uniform mat4 uni_CameraProduct = mat4(1.0);
+#if defined(DG_INSTANCED) && defined(DG_MULTIDRAW)
+  #error "The instanced path does not support multi-draw."
+#endif
+
+#if defined(DG_MULTIDRAW)
+  #extension GL_ARB_shader_draw_parameters : require
+#endif
+
+#if defined(DG_INSTANCED)
+  layout (location = 0) in vec2  in_Corner;
+  layout (location = 1) in vec2  in_TexCoords;
+  layout (location = 2) in vec4  in_Basis;
+  layout (location = 3) in vec3  in_Translation;
+  layout (location = 4) in vec4  in_Color;
+  layout (location = 5) in int   in_TexIndex;
+  layout (location = 6) in int   in_EntityId;
+  layout (location = 7) in vec4  in_TexRect;
+#else
+  layout (location = 0) in vec3  in_Position;
+  layout (location = 1) in vec2  in_TexCoords;
+  layout (location = 2) in vec4  in_Color;
+  layout (location = 3) in int   in_TexIndex;
+  layout (location = 4) in int   in_EntityId;
+#endif
+
+#include "include/frame_uniforms.glsl"
 
      out vec2 var_TexCoords;
 flat out int  var_TexIndex;
      out vec4 var_Color;
 flat out int  var_EntityId;
+flat out int  var_TableIndex;
 
 void main ()
 {
+#if defined(DG_INSTANCED)
+  vec2 position = mat2(in_Basis.xy, in_Basis.zw) * in_Corner + in_Translation.xy;
+
+  gl_Position = uni_CameraProduct * vec4(position, in_Translation.z, 1.0);
+  var_TexCoords = mix(in_TexRect.xy, in_TexRect.zw, in_TexCoords);
+#else
   gl_Position = uni_CameraProduct * vec4(in_Position, 1.0);
   var_TexCoords = in_TexCoords;
-  var_TexIndex = int(in_TexIndex);
+#endif
+
+  var_TexIndex = in_TexIndex;
   var_Color = in_Color;
-  var_EntityId = int(in_EntityId);
+  var_EntityId = in_EntityId;
+
+#if defined(DG_MULTIDRAW)
+  var_TableIndex = gl_BaseInstanceARB;
+#else
+  var_TableIndex = 0;
+#endif
 }
 
 
@@ -31,35 +72,32 @@ void main ()
 flat in int  var_TexIndex;
      in vec4 var_Color;
 flat in int  var_EntityId;
+flat in int  var_TableIndex;
 
-uniform sampler2D uni_TexSlots[16];
+#if !defined(DG_ALPHA_CUTOFF)
+  #define DG_ALPHA_CUTOFF 0.5
+#endif
+
+#if !defined(DG_UNTEXTURED)
+  #include "include/quad2d_textures.glsl"
+#endif
 
 layout (location = 0) out vec4 out_Color;
 layout (location = 1) out int  out_EntityId;
 
 void main ()
 {
+#if defined(DG_UNTEXTURED)
   vec4 textureColor = vec4(1.0);
-
-  switch (var_TexIndex) {
-    case 1:  textureColor = texture(uni_TexSlots[1],  var_TexCoords); break;
-    case 2:  textureColor = texture(uni_TexSlots[2],  var_TexCoords); break;
-    case 3:  textureColor = texture(uni_TexSlots[3],  var_TexCoords); break;
-    case 4:  textureColor = texture(uni_TexSlots[4],  var_TexCoords); break;
-    case 5:  textureColor = texture(uni_TexSlots[5],  var_TexCoords); break;
-    case 6:  textureColor = texture(uni_TexSlots[6],  var_TexCoords); break;
-    case 7:  textureColor = texture(uni_TexSlots[7],  var_TexCoords); break;
-    case 8:  textureColor = texture(uni_TexSlots[8],  var_TexCoords); break;
-    case 9:  textureColor = texture(uni_TexSlots[9],  var_TexCoords); break;
-    case 10: textureColor = texture(uni_TexSlots[10], var_TexCoords); break;
-    case 11: textureColor = texture(uni_TexSlots[11], var_TexCoords); break;
-    case 12: textureColor = texture(uni_TexSlots[12], var_TexCoords); break;
-    case 13: textureColor = texture(uni_TexSlots[13], var_TexCoords); break;
-    case 14: textureColor = texture(uni_TexSlots[14], var_TexCoords); break;
-    case 15: textureColor = texture(uni_TexSlots[15], var_TexCoords); break;
-    default: break;
-  }
+#else
+  vec4 textureColor = sampleQuadTexture(var_TexIndex, var_TexCoords, var_TableIndex);
+#endif
 
   out_Color = textureColor * var_Color;
+
+#if defined(DG_ALPHA_TEST)
+  if (out_Color.a < DG_ALPHA_CUTOFF) { discard; }
+#endif
+
   out_EntityId = var_EntityId;
-}
\ No newline at end of file
+}
@@ -15,7 +15,8 @@ newoption {
   value = "API",
   description = "Choose an API for graphics and rendering",
   allowed = {
-    { "glad",     "OpenGL via GLAD" }
+    { "glad",     "OpenGL via GLAD" },
+    { "null",     "Null (headless; records commands instead of drawing)" }
   },
   default = "glad"
 }
@@ -59,6 +60,8 @@ workspace "project-dg"
     defines { "DG_USING_GLFW" }
   filter { "options:gfxapi=glad" }
     defines { "DG_USING_OPENGL", "DG_USING_GLAD" }
+  filter { "options:gfxapi=null" }
+    defines { "DG_USING_NULL_GRAPHICS" }
   filter {}
 
   if _OPTIONS["winapi"] == "glfw" then
@@ -126,6 +129,12 @@ project "dg-engine"
     }
   end
 
+  if _OPTIONS["gfxapi"] == "null" then
+    files {
+      "./projects/dg-engine/src/DG/Null/*.cpp"
+    }
+  end
+
 -- Studio Application
 project "dg-studio"
 
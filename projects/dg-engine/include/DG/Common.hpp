@@ -21,14 +21,17 @@
 #include <tuple>
 #include <filesystem>
 #include <functional>
+#include <charconv>
 
 // C Includes
 #include <cstdlib>
 #include <cstdint>
+#include <cstring>
 #include <cmath>
 #include <cfloat>
 #include <ctime>
 #include <cassert>
+#include <cctype>
 
 namespace fs = std::filesystem;
 
@@ -78,5 +81,6 @@ namespace dg
   template <typename T>                 using Unique = std::unique_ptr<T>;
   template <typename T>                 using UniqueWithFree = std::unique_ptr<T, void (*) (void*)>;
   template <typename T>                 using Shared = std::shared_ptr<T>;
+  template <typename T>                 using Weak = std::weak_ptr<T>;
 
 }
\ No newline at end of file
@@ -7,6 +7,8 @@
 #include <DG/Core/Gui.hpp>
 #include <DG/Core/Window.hpp>
 #include <DG/Core/LayerStack.hpp>
+#include <DG/Core/ThreadPool.hpp>
+#include <DG/Graphics/AssetCache.hpp>
 #include <DG/Events/EventBus.hpp>
 
 namespace dg
@@ -29,6 +31,30 @@ namespace dg
      */
     F32 framerate = 60.0f;
 
+    /**
+     * @brief The number of worker threads in the application's thread pool. If zero, this is
+     *        determined by the number of hardware threads available.
+     */
+    Count workerThreadCount = 0;
+
+    /**
+     * @brief The directory in which linked shader programs are cached between launches. If empty,
+     *        shader programs are always built from source.
+     */
+    Path shaderCacheDirectory = "cache/shaders";
+
+    /**
+     * @brief The most bytes of texture data the application's texture loader streams to the
+     *        graphics card per frame.
+     */
+    Size textureUploadBudget = 8 * 1024 * 1024;
+
+    /**
+     * @brief The most bytes of texture data the application's asset cache keeps resident for
+     *        textures no longer in use.
+     */
+    Size assetMemoryBudget = 256 * 1024 * 1024;
+
   };
 
   /**
@@ -58,6 +84,9 @@ namespace dg
     static Window& getWindow ();
     static Renderer& getRenderer ();
     static LayerStack& getLayerStack ();
+    static ThreadPool& getThreadPool ();
+    static TextureLoader& getTextureLoader ();
+    static AssetCache& getAssetCache ();
 
   public:
 
@@ -69,7 +98,7 @@ namespace dg
   protected:
     void listenForEvent (Event& ev) override;
     void fixedUpdate ();
-    void update ();
+    void update (const F32 elapsedTime);
 
   protected:
 
@@ -89,6 +118,12 @@ namespace dg
 
     Unique<LayerStack> m_layerStack = nullptr;
 
+    Unique<ThreadPool> m_threadPool = nullptr;
+
+    Unique<TextureLoader> m_textureLoader = nullptr;
+
+    Unique<AssetCache> m_assetCache = nullptr;
+
     bool m_running = true;
 
     /**
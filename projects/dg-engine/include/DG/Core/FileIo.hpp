@@ -16,6 +16,12 @@ namespace dg
     static bool loadTextFile (const Path& path, const LineFunction& lineFunction);
     static bool loadBinaryFile (const Path& path, Collection<U8>& contents);
 
+    /**
+     * @brief Writes the given bytes to the binary file at the given path, replacing its contents.
+     *        The file's parent directories are created if they do not exist.
+     */
+    static bool saveBinaryFile (const Path& path, const void* data, const Size size);
+
   };
 
 }
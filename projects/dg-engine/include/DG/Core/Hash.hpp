@@ -0,0 +1,32 @@
+/** @file DG/Core/Hash.hpp */
+
+#pragma once
+
+#include <DG_Pch.hpp>
+
+namespace dg
+{
+
+  constexpr U64 FNV1A_OFFSET_BASIS = 0xCBF29CE484222325ull;
+  constexpr U64 FNV1A_PRIME = 0x00000100000001B3ull;
+
+  /**
+   * @brief Hashes the given bytes with the 64-bit FNV-1a hash. Hashing continues from the given
+   *        hash, so that several inputs can be hashed one after another as if they were one.
+   */
+  inline U64 fnv1a (const void* data, const Size size, U64 hash = FNV1A_OFFSET_BASIS)
+  {
+    const U8* bytes = static_cast<const U8*>(data);
+    for (Index i = 0; i < size; ++i) {
+      hash = (hash ^ bytes[i]) * FNV1A_PRIME;
+    }
+
+    return hash;
+  }
+
+  inline U64 fnv1a (StringView string, U64 hash = FNV1A_OFFSET_BASIS)
+  {
+    return fnv1a(string.data(), string.size(), hash);
+  }
+
+}
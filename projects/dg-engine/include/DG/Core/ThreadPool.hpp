@@ -0,0 +1,76 @@
+/** @file DG/Core/ThreadPool.hpp */
+
+#pragma once
+
+#include <DG_Pch.hpp>
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+
+namespace dg
+{
+
+  /**
+   * @brief The @a `ThreadPool` class runs tasks on a fixed set of worker threads.
+   */
+  class ThreadPool
+  {
+  public:
+    using Task = std::function<void ()>;
+    using RangeTask = std::function<void (Index begin, Index end, Index chunk)>;
+
+  public:
+
+    /**
+     * @brief Constructs a @a `ThreadPool` with the given number of worker threads. If that number
+     *        is zero, one fewer worker than the machine has hardware threads is used (at least one),
+     *        leaving a hardware thread for the main thread.
+     */
+    ThreadPool (const Count threadCount = 0);
+    ~ThreadPool ();
+
+  public:
+    static Unique<ThreadPool> make (const Count threadCount = 0);
+
+  public:
+
+    /**
+     * @brief Queues the given task to be run on a worker thread. Exceptions escaping the task are
+     *        logged and discarded.
+     */
+    void submit (Task task);
+
+    /**
+     * @brief Blocks until every queued task has finished running.
+     */
+    void wait ();
+
+    /**
+     * @brief Splits the range [0, count) into the given number of contiguous chunks and runs the
+     *        given task on each, with the calling thread running the first chunk itself. Blocks
+     *        until every chunk is done. If the chunk count is zero, one chunk is used per worker
+     *        thread, plus one for the calling thread. The first exception escaping a chunk is
+     *        rethrown on the calling thread.
+     */
+    void parallelFor (const Count count, const RangeTask& task, Count chunkCount = 0);
+
+  public:
+    inline Count getThreadCount () const { return m_threads.size(); }
+
+  private:
+    void work ();
+
+  private:
+    Collection<std::thread> m_threads;
+    std::deque<Task> m_tasks;
+    std::mutex m_mutex;
+    std::condition_variable m_taskCondition;
+    std::condition_variable m_idleCondition;
+    Count m_busyCount = 0;
+    bool m_stopping = false;
+
+  };
+
+}
@@ -0,0 +1,113 @@
+/** @file DG/Graphics/AssetCache.hpp */
+
+#pragma once
+
+#include <DG/Graphics/Shader.hpp>
+#include <DG/Graphics/Texture.hpp>
+#include <DG/Graphics/TextureLoader.hpp>
+
+namespace dg
+{
+
+  struct AssetCacheSpecification
+  {
+
+    /**
+     * @brief The most bytes of texture data the cache keeps resident for textures which are no
+     *        longer used outside of it. Textures still in use are never evicted, and so may take
+     *        the cache over this budget.
+     */
+    Size memoryBudget = 256 * 1024 * 1024;
+
+  };
+
+  /**
+   * @brief The @a `AssetCacheStats` struct counts an @a `AssetCache`'s lookups since its stats were
+   *        last reset. A hit is a lookup answered by an asset already in the cache; a miss is one
+   *        which had to load its asset.
+   */
+  struct AssetCacheStats
+  {
+    Count hitCount = 0;
+    Count missCount = 0;
+    Count evictionCount = 0;
+  };
+
+  /**
+   * @brief The @a `AssetCache` class loads textures and shaders by path, and hands out shared
+   *        handles to them, so that each asset is loaded and uploaded to the graphics card only
+   *        once, however many users ask for it.
+   *
+   * Paths are made absolute and normalized before being looked up, so different spellings of the
+   * same path share one asset. The cache holds onto every asset it loads, and only evicts those no
+   * longer used outside of it, least recently requested first, while its resident texture data is
+   * over its memory budget. Shaders count toward the cache's entries, but not its resident bytes.
+   */
+  class AssetCache
+  {
+  public:
+    AssetCache (const AssetCacheSpecification& spec = {}, TextureLoader* textureLoader = nullptr);
+
+  public:
+    static Unique<AssetCache> make (const AssetCacheSpecification& spec = {},
+      TextureLoader* textureLoader = nullptr);
+
+  public:
+
+    /**
+     * @brief Retrieves the texture loaded from the image file at the given path, loading it if it
+     *        is not in the cache. If asynchronous, and this cache has a texture loader, a texture
+     *        not in the cache is loaded through it (see @a `TextureLoader::load`).
+     */
+    Shared<Texture> getTexture (const Path& path, const bool async = false);
+
+    /**
+     * @brief Retrieves the permutation of the shader at the given path with the given defines,
+     *        building it if it is not in the cache (see @a `Shader::make`).
+     */
+    Shared<Shader> getShader (const Path& path, const ShaderDefines& defines = {});
+
+    /**
+     * @brief Evicts the least recently requested assets no longer used outside of this cache,
+     *        until its resident texture data fits its memory budget. This is done after each miss.
+     */
+    void collect ();
+
+    /**
+     * @brief Evicts every asset no longer used outside of this cache, regardless of its budget.
+     */
+    void purge ();
+
+    void setMemoryBudget (const Size memoryBudget);
+    void resetStats ();
+
+  public:
+    inline Size getMemoryBudget () const { return m_memoryBudget; }
+    inline const AssetCacheStats& getStats () const { return m_stats; }
+    inline Count getEntryCount () const { return m_textures.size() + m_shaders.size(); }
+
+    /**
+     * @brief Retrieves the number of bytes of texture data held by this cache's textures, at their
+     *        current sizes.
+     */
+    Size getResidentSize () const;
+
+  private:
+    template <typename T>
+    struct Entry
+    {
+      Shared<T> asset = nullptr;
+      Count lastUsed = 0;
+    };
+
+  private:
+    TextureLoader* m_textureLoader = nullptr;
+    Dictionary<Entry<Texture>> m_textures;
+    Dictionary<Entry<Shader>> m_shaders;
+    Size m_memoryBudget = 0;
+    Count m_useCounter = 0;
+    AssetCacheStats m_stats;
+
+  };
+
+}
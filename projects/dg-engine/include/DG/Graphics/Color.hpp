@@ -27,6 +27,24 @@ namespace dg
       };
     }
 
+    /**
+     * @brief Packs the given color into four normalized bytes, in red, green, blue, alpha order in
+     *        memory, as expected by an @a `Ubyte4` vertex attribute.
+     */
+    inline U32 packRGBA8 (const Vector4f& color)
+    {
+      U8 bytes[4] = {
+        static_cast<U8>(clamp(color.x, 0.0f, 1.0f) * 255.0f + 0.5f),
+        static_cast<U8>(clamp(color.y, 0.0f, 1.0f) * 255.0f + 0.5f),
+        static_cast<U8>(clamp(color.z, 0.0f, 1.0f) * 255.0f + 0.5f),
+        static_cast<U8>(clamp(color.w, 0.0f, 1.0f) * 255.0f + 0.5f)
+      };
+
+      U32 packed = 0;
+      std::memcpy(&packed, bytes, sizeof(U32));
+      return packed;
+    }
+
     inline Vector4f fromRGB5 (I32 red, I32 green, I32 blue)
     {
       return {
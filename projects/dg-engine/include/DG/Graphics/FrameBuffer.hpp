@@ -57,20 +57,64 @@ namespace dg
     Collection<FrameBufferTextureSpecification> attachments;
   };
 
+  /**
+   * @brief The @a `FrameBufferResizePolicy` struct describes how a framebuffer's attachments follow
+   *        changes to its size.
+   *
+   * With a bucket size of zero, the attachments are rebuilt at exactly the framebuffer's size
+   * whenever it changes. Otherwise, they are allocated at its size rounded up to a multiple of the
+   * bucket size, and only grow right away; the framebuffer is drawn into the lower-left corner of
+   * its larger attachments. Attachments are only shrunk once they have been larger than needed for
+   * the given number of consecutive @a `FrameBuffer::setSize` calls.
+   */
+  struct FrameBufferResizePolicy
+  {
+    U32 bucketSize = 0;
+    Count shrinkDelay = 0;
+  };
+
   struct FrameBufferSpecification
   {
     Vector2u size = { 1280, 720 };
     Count sampleCount = 1;
     bool swapChainTarget = false;
     FrameBufferAttachmentSpecification attachmentSpec;
+    FrameBufferResizePolicy resizePolicy;
+
+    /**
+     * @brief The fraction, in (0, 1], of the framebuffer's size at which it is drawn. See
+     *        @a `FrameBuffer::setRenderScale`.
+     */
+    F32 renderScale = 1.0f;
   };
 
-  class FrameBuffer
+  /**
+   * @brief The @a `FrameBufferReadback` struct is the result of an asynchronous read of a region of
+   *        a framebuffer's integer color attachment.
+   *
+   * It becomes ready once the graphics card has finished copying out the region, usually a frame or
+   * two after it was requested, at which point @a `values` holds the region's distinct values, in
+   * ascending order (for a single pixel, just its value). Its callback, if any, is called then. Its
+   * offset and size are those of the region actually read, within the framebuffer's drawn region.
+   */
+  struct FrameBufferReadback
+  {
+    using Callback = std::function<void (const FrameBufferReadback&)>;
+
+    Index attachmentIndex = 0;
+    Vector2i offset = { 0, 0 };
+    Vector2i size = { 0, 0 };
+    Callback callback = nullptr;
+    bool ready = false;
+    Collection<I32> values;
+
+    inline bool isReady () const { return ready; }
+  };
+
+  class FrameBuffer : public std::enable_shared_from_this<FrameBuffer>
   {
   protected:
-    FrameBuffer (const FrameBufferSpecification& spec) :
-      m_spec { spec }
-    {}
+    FrameBuffer (const FrameBufferSpecification& spec);
 
   public:
     virtual ~FrameBuffer () = default;
@@ -87,34 +131,125 @@ namespace dg
     virtual I32 readPixelI32 (const Index index, const Vector2i& position) const = 0;
     virtual I32 readPixelI32 (const Index index, const Vector2f& position) const = 0;
 
+    /**
+     * @brief Starts reading the pixel at the given position of the color attachment at the given
+     *        index, without waiting on the graphics card. A position outside of this framebuffer
+     *        reads as -1 right away.
+     */
+    Shared<FrameBufferReadback> readPixelI32Async (const Index index, const Vector2i& position,
+      const FrameBufferReadback::Callback& callback = nullptr);
+
+    /**
+     * @brief Starts reading the distinct values in the rectangular region with the given offset and
+     *        size of the color attachment at the given index, without waiting on the graphics card.
+     *        The region is clipped to this framebuffer; if nothing is left, it is ready right away,
+     *        with no values.
+     */
+    Shared<FrameBufferReadback> readRegionI32Async (const Index index, const Vector2i& offset,
+      const Vector2i& size, const FrameBufferReadback::Callback& callback = nullptr);
+
+    /**
+     * @brief Finishes every one of this framebuffer's readbacks which the graphics card is done
+     *        with, or, if waiting, every one of them.
+     *
+     * @return  True if no readbacks are left pending.
+     */
+    virtual bool pollReadbacks (const bool wait = false) = 0;
+
+    /**
+     * @brief Polls the readbacks of every framebuffer with readbacks pending. This is called once
+     *        per frame by the application.
+     */
+    static void pollPendingReadbacks ();
+
   public:
     inline const Vector2u& getSize () const { return m_spec.size; }
     inline U32 getWidth () const { return m_spec.size.x; }
     inline U32 getHeight () const { return m_spec.size.y; }
 
-    inline bool setSize (const Vector2u& size)
-    {
-      if (size.x > 0 && size.y > 0 && size != m_spec.size) {
-        m_spec.size = size;
-        onSizeChanged();
-        return true;
-      }
+    /**
+     * @brief Retrieves the size of this framebuffer's attachments, which may be larger than the
+     *        framebuffer itself under its resize policy.
+     */
+    inline const Vector2u& getAllocatedSize () const { return m_allocatedSize; }
+
+    /**
+     * @brief Retrieves the size of the region of this framebuffer's attachments which it draws
+     *        into: its size scaled by its render scale.
+     */
+    Vector2u getRenderSize () const;
 
-      return false;
+    /**
+     * @brief Retrieves the texture coordinates of the upper-right corner of the region of this
+     *        framebuffer's attachments which it draws into.
+     */
+    inline Vector2f getTexCoordScale () const
+    {
+      Vector2u renderSize = getRenderSize();
+      return {
+        static_cast<F32>(renderSize.x) / m_allocatedSize.x,
+        static_cast<F32>(renderSize.y) / m_allocatedSize.y
+      };
     }
 
+    inline F32 getRenderScale () const { return m_spec.renderScale; }
+
+    /**
+     * @brief Sets the fraction, clamped to (0, 1], of this framebuffer's size at which it is drawn.
+     *        Its attachments keep their size, so changing this costs nothing on the graphics card.
+     *        Positions passed to this framebuffer's pixel reads remain relative to its full size.
+     *        Whatever displays this framebuffer's color attachment upscales it by sampling only up
+     *        to @a `getTexCoordScale`.
+     */
+    void setRenderScale (const F32 renderScale);
+
+    /**
+     * @brief Sets the size of this framebuffer, resizing its attachments as its resize policy
+     *        dictates. This should be called each frame by a user which follows a changing size, so
+     *        that its attachments can eventually shrink.
+     *
+     * @return  True if the framebuffer's size changed.
+     */
+    bool setSize (const Vector2u& size);
+
     inline bool setSize (const U32 width, const U32 height) 
     {
       return setSize({ width, height });
     }
 
   protected:
-    virtual void onSizeChanged () = 0;
+    virtual void onAllocatedSizeChanged () = 0;
+
+    /**
+     * @brief Starts copying out the given readback's region, which lies within this framebuffer.
+     */
+    virtual void beginReadback (const Shared<FrameBufferReadback>& readback) = 0;
+
+    /**
+     * @brief Sorts the given readback's values, removes duplicates, marks it ready and calls its
+     *        callback.
+     */
+    static void finishReadback (FrameBufferReadback& readback);
+
+    /**
+     * @brief Maps the given position, relative to this framebuffer's full size, onto its drawn
+     *        region.
+     */
+    Vector2i getRenderPosition (const Vector2i& position) const;
+
+  private:
+    Vector2u getBucketedSize (const Vector2u& size) const;
+    void listPendingReadbacks ();
 
   protected:
     FrameBufferSpecification m_spec;
     Collection<FrameBufferTextureSpecification> m_colorAttachmentSpecs;
     FrameBufferTextureSpecification m_depthAttachmentSpec;
+    Vector2u m_allocatedSize;
+    Count m_shrinkCounter = 0;
+
+  private:
+    static inline Collection<Weak<FrameBuffer>> s_pendingFrameBuffers;
 
   };
 
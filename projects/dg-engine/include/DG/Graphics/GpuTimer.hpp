@@ -0,0 +1,69 @@
+/** @file DG/Graphics/GpuTimer.hpp */
+
+#pragma once
+
+#include <DG_Pch.hpp>
+
+namespace dg
+{
+
+  /**
+   * @brief The @a `GpuTimer` class measures how long the graphics card spends on a frame, and on
+   *        ranges of commands within it, without stalling the CPU to wait for the answer.
+   *
+   * Queries are kept in a ring of frames. Results are read back when a frame's queries come around
+   * again, which is @a `getLatency` frames after they were issued; a frame whose queries are still
+   * not done by then is discarded rather than waited on. Ranges may not overlap.
+   */
+  class GpuTimer
+  {
+  protected:
+    GpuTimer () = default;
+
+  public:
+    virtual ~GpuTimer () = default;
+
+  public:
+    static Unique<GpuTimer> make (const Count latency = 3);
+
+  public:
+    virtual void beginFrame () = 0;
+    virtual void endFrame () = 0;
+    virtual void beginRange () = 0;
+    virtual void endRange () = 0;
+
+  public:
+
+    /**
+     * @brief Retrieves the time, in milliseconds, between the beginning and end of the most recent
+     *        frame whose results have been read back.
+     */
+    inline F64 getFrameTime () const { return m_frameTime; }
+
+    /**
+     * @brief Retrieves the times, in milliseconds, of the ranges in the most recent frame whose
+     *        results have been read back, in the order they were begun.
+     */
+    inline const Collection<F64>& getRangeTimes () const { return m_rangeTimes; }
+
+    inline Count getDiscardedFrameCount () const { return m_discardedFrameCount; }
+    inline bool hasResults () const { return m_hasResults; }
+
+    /**
+     * @brief Returns whether the last call to @a `beginFrame` read back a frame's results, rather
+     *        than discarding them and leaving those of an earlier frame in place.
+     */
+    inline bool hasNewResults () const { return m_hasNewResults; }
+
+    virtual Count getLatency () const = 0;
+
+  protected:
+    F64 m_frameTime = 0.0;
+    Collection<F64> m_rangeTimes;
+    Count m_discardedFrameCount = 0;
+    bool m_hasResults = false;
+    bool m_hasNewResults = false;
+
+  };
+
+}
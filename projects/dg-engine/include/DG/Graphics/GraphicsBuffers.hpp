@@ -24,6 +24,12 @@ namespace dg
     virtual void unbind () const = 0;
     virtual void upload (const void*, const Size) = 0;
 
+    /**
+     * @brief Uploads data into the range of this @a `VertexBuffer` starting at the given offset, in
+     *        bytes, leaving the rest of the buffer untouched.
+     */
+    virtual void uploadRange (const void*, const Size, const Size offset) = 0;
+
   public:
     template <typename T>
     inline static Shared<VertexBuffer> makeFrom (const Collection<T>& vertices,
@@ -56,7 +62,9 @@ namespace dg
         count = vertices.size();
       }
 
-      upload(vertices.data(), vertices.size() * sizeof(T));
+      if (count == 0) { return; }
+
+      upload(vertices.data(), count * sizeof(T));
     }
 
   public:
@@ -73,6 +81,66 @@ namespace dg
 
   };
 
+  /**
+   * @brief The @a `StreamingVertexBuffer` class is a vertex buffer which is persistently mapped into
+   *        client memory and split into a ring of equally-sized regions.
+   * 
+   * Vertices are written straight into the acquired region's mapped memory. Once the region has
+   * been drawn from, it is released; the graphics backend fences it, and it is not handed out
+   * again until the graphics card is done reading from it.
+   */
+  class StreamingVertexBuffer : public VertexBuffer
+  {
+  protected:
+    StreamingVertexBuffer () = default;
+
+  public:
+    virtual ~StreamingVertexBuffer () = default;
+
+  public:
+    static Shared<StreamingVertexBuffer> make (const Size regionSize, const Count regionCount = 3);
+
+  public:
+
+    /**
+     * @brief Acquires the current region of the ring, waiting until the graphics card is done
+     *        reading from it, if needed. Acquiring an already-acquired region is a no-op.
+     * 
+     * @return  A pointer to the start of the region's mapped memory.
+     */
+    virtual void* acquireRegion () = 0;
+
+    /**
+     * @brief Releases the current region of the ring, fencing it against any draw commands which
+     *        were issued from it, then advances to the next region.
+     */
+    virtual void releaseRegion () = 0;
+
+  public:
+    template <typename T>
+    inline T* acquireRegionAs ()
+    {
+      static_assert(std::is_standard_layout_v<T>,
+        "[StreamingVertexBuffer] 'T' must be of a standard layout.");
+
+      return static_cast<T*>(acquireRegion());
+    }
+
+  public:
+    inline bool isRegionAcquired () const { return m_regionAcquired; }
+    inline Size getRegionSize () const { return m_regionSize; }
+    inline Count getRegionCount () const { return m_regionCount; }
+    inline Index getRegionIndex () const { return m_regionIndex; }
+    inline Size getRegionOffset () const { return m_regionIndex * m_regionSize; }
+
+  protected:
+    bool m_regionAcquired = false;
+    Size m_regionSize = 0;
+    Count m_regionCount = 0;
+    Index m_regionIndex = 0;
+
+  };
+
   class IndexBuffer
   {
   protected:
@@ -99,4 +167,262 @@ namespace dg
 
   };
 
+  /**
+   * @brief The @a `DrawIndexedIndirectCommand` struct describes one indexed draw of a multi-draw,
+   *        as read by the graphics card from an @a `IndirectBuffer`.
+   */
+  struct DrawIndexedIndirectCommand
+  {
+    U32 indexCount;
+    U32 instanceCount;
+    U32 firstIndex;
+    I32 baseVertex;
+    U32 baseInstance;
+  };
+
+  class IndirectBuffer
+  {
+  protected:
+    IndirectBuffer () = default;
+
+  public:
+    virtual ~IndirectBuffer () = default;
+
+  public:
+    static Shared<IndirectBuffer> allocate (const Count commandCount);
+
+  public:
+    virtual void bind () const = 0;
+    virtual void unbind () const = 0;
+    virtual void upload (const DrawIndexedIndirectCommand* commands, const Count count) = 0;
+
+  public:
+    inline Count getCommandCount () const { return m_commandCount; }
+
+  protected:
+    Count m_commandCount = 0;
+
+  };
+
+  /**
+   * @brief The @a `StreamingIndirectBuffer` class is an indirect buffer which is persistently
+   *        mapped into client memory and split into a ring of equally-sized regions, as with the
+   *        @a `StreamingVertexBuffer`.
+   * 
+   * Draw commands are written straight into the acquired region's mapped memory, and drawn from
+   * there by passing the region's first command to @a `RenderCommand::multiDrawIndexedIndirect`.
+   */
+  class StreamingIndirectBuffer : public IndirectBuffer
+  {
+  protected:
+    StreamingIndirectBuffer () = default;
+
+  public:
+    virtual ~StreamingIndirectBuffer () = default;
+
+  public:
+    static Shared<StreamingIndirectBuffer> make (const Count regionCommandCount,
+      const Count regionCount = 3);
+
+  public:
+
+    /**
+     * @brief Acquires the current region of the ring, waiting until the graphics card is done
+     *        reading from it, if needed. Acquiring an already-acquired region is a no-op.
+     * 
+     * @return  A pointer to the first command of the region's mapped memory.
+     */
+    virtual DrawIndexedIndirectCommand* acquireRegion () = 0;
+
+    /**
+     * @brief Releases the current region of the ring, fencing it against any draw commands which
+     *        were issued from it, then advances to the next region.
+     */
+    virtual void releaseRegion () = 0;
+
+  public:
+    inline bool isRegionAcquired () const { return m_regionAcquired; }
+    inline Count getRegionCommandCount () const { return m_regionCommandCount; }
+    inline Count getRegionCount () const { return m_regionCount; }
+    inline Index getRegionIndex () const { return m_regionIndex; }
+    inline Index getRegionFirstCommand () const { return m_regionIndex * m_regionCommandCount; }
+
+  protected:
+    bool m_regionAcquired = false;
+    Count m_regionCommandCount = 0;
+    Count m_regionCount = 0;
+    Index m_regionIndex = 0;
+
+  };
+
+  /**
+   * @brief The @a `StorageBuffer` class is a buffer which shaders can read through a storage block
+   *        bound to the same binding index.
+   */
+  class StorageBuffer
+  {
+  protected:
+    StorageBuffer () = default;
+
+  public:
+    virtual ~StorageBuffer () = default;
+
+  public:
+    static Shared<StorageBuffer> allocate (const Size size);
+
+  public:
+    virtual void bind (const Index binding) const = 0;
+    virtual void unbind (const Index binding) const = 0;
+    virtual void upload (const void*, const Size) = 0;
+
+  public:
+    inline Size getByteSize () const { return m_byteSize; }
+
+  protected:
+    Size m_byteSize = 0;
+
+  };
+
+  /**
+   * @brief The @a `StreamingStorageBuffer` class is a storage buffer which is persistently mapped
+   *        into client memory and split into a ring of equally-sized regions, as with the
+   *        @a `StreamingVertexBuffer`.
+   * 
+   * Data is written straight into the acquired region's mapped memory. The whole buffer stays
+   * bound, so shaders must offset their reads into the region which was written, e.g. by each
+   * draw's base instance.
+   */
+  class StreamingStorageBuffer : public StorageBuffer
+  {
+  protected:
+    StreamingStorageBuffer () = default;
+
+  public:
+    virtual ~StreamingStorageBuffer () = default;
+
+  public:
+    static Shared<StreamingStorageBuffer> make (const Size regionSize, const Count regionCount = 3);
+
+  public:
+
+    /**
+     * @brief Acquires the current region of the ring, waiting until the graphics card is done
+     *        reading from it, if needed. Acquiring an already-acquired region is a no-op.
+     * 
+     * @return  A pointer to the start of the region's mapped memory.
+     */
+    virtual void* acquireRegion () = 0;
+
+    /**
+     * @brief Releases the current region of the ring, fencing it against any draw commands which
+     *        were issued while it was bound, then advances to the next region.
+     */
+    virtual void releaseRegion () = 0;
+
+  public:
+    template <typename T>
+    inline T* acquireRegionAs ()
+    {
+      static_assert(std::is_standard_layout_v<T>,
+        "[StreamingStorageBuffer] 'T' must be of a standard layout.");
+
+      return static_cast<T*>(acquireRegion());
+    }
+
+  public:
+    inline bool isRegionAcquired () const { return m_regionAcquired; }
+    inline Size getRegionSize () const { return m_regionSize; }
+    inline Count getRegionCount () const { return m_regionCount; }
+    inline Index getRegionIndex () const { return m_regionIndex; }
+    inline Size getRegionOffset () const { return m_regionIndex * m_regionSize; }
+
+  protected:
+    bool m_regionAcquired = false;
+    Size m_regionSize = 0;
+    Count m_regionCount = 0;
+    Index m_regionIndex = 0;
+
+  };
+
+  /**
+   * @brief The @a `UniformBuffer` class is a buffer which shaders can read through a uniform block
+   *        bound to the same binding index. Its contents must follow the block's std140 layout.
+   */
+  class UniformBuffer
+  {
+  protected:
+    UniformBuffer () = default;
+
+  public:
+    virtual ~UniformBuffer () = default;
+
+  public:
+    static Shared<UniformBuffer> allocate (const Size size);
+
+  public:
+    virtual void bind (const Index binding) const = 0;
+    virtual void unbind (const Index binding) const = 0;
+    virtual void upload (const void*, const Size) = 0;
+
+  public:
+    inline Size getByteSize () const { return m_byteSize; }
+
+  protected:
+    Size m_byteSize = 0;
+
+  };
+
+  /**
+   * @brief The @a `PixelUploadBuffer` class is a pixel buffer which is persistently mapped into
+   *        client memory and split into a ring of equally-sized regions, through which pixel data
+   *        is streamed into textures.
+   *
+   * Pixels are written straight into the acquired region's mapped memory, and uploaded from there
+   * into textures with @a `Texture::uploadRegion`, which the graphics card does without the
+   * calling thread waiting on the transfer. Once the uploads have been issued, the region is
+   * released; the graphics backend fences it, and it is not handed out again until the graphics
+   * card is done reading from it.
+   */
+  class PixelUploadBuffer
+  {
+  protected:
+    PixelUploadBuffer () = default;
+
+  public:
+    virtual ~PixelUploadBuffer () = default;
+
+  public:
+    static Shared<PixelUploadBuffer> make (const Size regionSize, const Count regionCount = 3);
+
+  public:
+
+    /**
+     * @brief Acquires the current region of the ring, waiting until the graphics card is done
+     *        reading from it, if needed. Acquiring an already-acquired region is a no-op.
+     *
+     * @return  A pointer to the start of the region's mapped memory.
+     */
+    virtual void* acquireRegion () = 0;
+
+    /**
+     * @brief Releases the current region of the ring, fencing it against any uploads which were
+     *        issued from it, then advances to the next region.
+     */
+    virtual void releaseRegion () = 0;
+
+  public:
+    inline bool isRegionAcquired () const { return m_regionAcquired; }
+    inline Size getRegionSize () const { return m_regionSize; }
+    inline Count getRegionCount () const { return m_regionCount; }
+    inline Index getRegionIndex () const { return m_regionIndex; }
+    inline Size getRegionOffset () const { return m_regionIndex * m_regionSize; }
+
+  protected:
+    bool m_regionAcquired = false;
+    Size m_regionSize = 0;
+    Count m_regionCount = 0;
+    Index m_regionIndex = 0;
+
+  };
+
 }
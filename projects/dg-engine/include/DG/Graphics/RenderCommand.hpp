@@ -16,7 +16,22 @@ namespace dg
     static void setClearColor (const Vector4f& color);
     static void setViewport (I32 x, I32 y, I32 width, I32 height);
     static void setViewport (I32 width, I32 height);
-    static void drawIndexed (const Shared<VertexArray>& vao, Count indexCount = 0);
+    static void drawIndexed (const Shared<VertexArray>& vao, Count indexCount = 0,
+      Count baseVertex = 0);
+    static void drawIndexedInstanced (const Shared<VertexArray>& vao, Count indexCount,
+      Count instanceCount, Count baseInstance = 0);
+
+    /**
+     * @brief Issues the given number of indexed draws, described by the commands in the given
+     *        @a `IndirectBuffer` starting at @a `firstCommand`, with a single call.
+     */
+    static void multiDrawIndexedIndirect (const Shared<VertexArray>& vao,
+      const Shared<IndirectBuffer>& commands, Count drawCount, Index firstCommand = 0);
+
+    /**
+     * @brief Retrieves the number of texture units which a fragment shader can sample from.
+     */
+    static Count getTextureUnitCount ();
 
   private:
     static Unique<RenderInterface> s_interface;
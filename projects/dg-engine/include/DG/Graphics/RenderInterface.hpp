@@ -24,7 +24,13 @@ namespace dg
     virtual void setClearColor (const Vector4f& color) = 0;
     virtual void setViewport (I32 x, I32 y, I32 width, I32 height) = 0;
     virtual void setViewport (I32 width, I32 height) = 0;
-    virtual void drawIndexed (const Shared<VertexArray>& vao, Count indexCount = 0) = 0;
+    virtual void drawIndexed (const Shared<VertexArray>& vao, Count indexCount = 0,
+      Count baseVertex = 0) = 0;
+    virtual void drawIndexedInstanced (const Shared<VertexArray>& vao, Count indexCount,
+      Count instanceCount, Count baseInstance = 0) = 0;
+    virtual void multiDrawIndexedIndirect (const Shared<VertexArray>& vao,
+      const Shared<IndirectBuffer>& commands, Count drawCount, Index firstCommand = 0) = 0;
+    virtual Count getTextureUnitCount () const = 0;
 
   };  
 
@@ -7,18 +7,334 @@
 #include <DG/Graphics/Shader.hpp>
 #include <DG/Graphics/FrameBuffer.hpp>
 #include <DG/Graphics/Texture.hpp>
+#include <DG/Graphics/TextureAtlas.hpp>
 #include <DG/Graphics/RenderCommand.hpp>
+#include <DG/Graphics/GpuTimer.hpp>
 
 namespace dg
 {
 
+  /**
+   * @brief The binding index of the @a `Renderer`'s frame uniform block.
+   */
+  constexpr Index FRAME_UNIFORM_BINDING = 0;
+
+  /**
+   * @brief The @a `FrameUniforms` struct is the contents of the @a `Renderer`'s frame uniform block,
+   *        which is uploaded once per frame (and once per scene, for its camera) and which any shader
+   *        can read by declaring the matching std140 block:
+   *
+   *            layout (std140, row_major, binding = 0) uniform FrameUniforms
+   *            {
+   *              mat4  uni_CameraProduct;
+   *              vec2  uni_ViewportSize;
+   *              float uni_Time;
+   *              float uni_DeltaTime;
+   *            };
+   *
+   *        Matrices are stored row by row, hence @a `row_major`. Times are in seconds.
+   */
+  struct FrameUniforms
+  {
+    Matrix4f  cameraProduct = Matrix4f::IDENTITY;
+    Vector2f  viewportSize = { 0.0f, 0.0f };
+    F32       time = 0.0f;
+    F32       deltaTime = 0.0f;
+  };
+
+  static_assert(sizeof(FrameUniforms) == 80,
+    "[FrameUniforms] Layout must match the std140 'FrameUniforms' block.");
+
+  /**
+   * @brief The @a `QuadVertex2D` struct is the packed vertex format streamed to the graphics card
+   *        when rendering batched quads. Texture coordinates are normalized 16-bit integers, the
+   *        color is four normalized bytes (see @a `Color::packRGBA8`), and the texture index and
+   *        entity ID are true integers, so entity IDs survive intact into the entity ID attachment.
+   */
   struct QuadVertex2D
   {
-    Vector3f  position;
+    Vector3f      position;
+    Vector2<U16>  texCoords;
+    U32           color;
+    I32           texIndex;
+    I32           entityId;
+  };
+
+  struct QuadCorner2D
+  {
+    Vector2f  position;
     Vector2f  texCoords;
-    Vector4f  color;
-    F32       texIndex;
-    F32       entityId;
+  };
+
+  /**
+   * @brief The @a `QuadInstance2D` struct is the per-instance record streamed to the graphics card
+   *        when rendering quads with the instanced path. The unit quad's corners are expanded into
+   *        vertices by the instanced quad shader, using the 2x2 linear part of the quad's transform
+   *        (stored column by column in @a `basis`) and its translation. The corners' texture
+   *        coordinates are mapped into @a `texRect`, stored as normalized 16-bit integers.
+   */
+  struct QuadInstance2D
+  {
+    Vector4f      basis;
+    Vector3f      translation;
+    U32           color;
+    I32           texIndex;
+    I32           entityId;
+    Vector4<U16>  texRect;
+  };
+
+  enum class QuadRenderMode2D
+  {
+    BATCHED,
+    INSTANCED
+  };
+
+  /**
+   * @brief The @a `TextureBindingMode2D` enum determines how the textures referenced by a batch of
+   *        quads are made available to the quad shader.
+   *
+   * In @a `SLOTS` mode, each distinct texture occupies one of the @a `TEXTURE_SLOT_COUNT` texture
+   * slots, and the batch is flushed once they are all used. In @a `ARRAYS` mode, textures are copied
+   * into the layers of texture arrays grouped by size and format, and each distinct texture array
+   * occupies a slot instead, so a batch can reference thousands of textures. @a `ARRAYS` mode
+   * requires a quad shader which samples from @a `sampler2DArray uni_TexArrays[]`, such as
+   * @a `assets/quad2d.glsl` built with @a `DG_ARRAYS` defined.
+   */
+  enum class TextureBindingMode2D
+  {
+    SLOTS,
+    ARRAYS
+  };
+
+  /**
+   * @brief The @a `SubmissionMode2D` enum determines when submitted quads are expanded into batches.
+   *
+   * In @a `IMMEDIATE` mode, each quad is written into the current batch as it is submitted. In
+   * @a `DEFERRED` mode, quads are recorded as @a `QuadCommand2D`s with a 64-bit sort key, and are
+   * sorted and expanded into batches at the end of the scene (or whenever the scene's render state
+   * changes). The sort key orders quads by layer, then by shader, then back-to-front by depth, then
+   * by texture, so quads sharing a layer and depth are grouped by texture.
+   */
+  enum class SubmissionMode2D
+  {
+    IMMEDIATE,
+    DEFERRED
+  };
+
+  /**
+   * @brief The @a `FlushReason2D` enum records why a batch of quads was drawn.
+   */
+  enum class FlushReason2D
+  {
+    VERTEX_CAPACITY,
+    INDEX_CAPACITY,
+    TEXTURE_SLOTS,
+    TEXTURE_LAYER_RECYCLE,
+    SHADER_CHANGE,
+    FRAMEBUFFER_CHANGE,
+    STATE_CHANGE,
+    RETAINED_QUADS,
+    END_OF_SCENE,
+    MANUAL
+  };
+
+  constexpr Count FLUSH_REASON_2D_COUNT = 10;
+
+  /**
+   * @brief The @a `RenderStats2D` struct collects statistics about a @a `Renderer`'s current (or
+   *        most recent) 2D scene. Batches drawn by flushing are counted by reason; retained quad
+   *        chunks are counted as batches, but not as flushes. In multi-draw mode, each batch is
+   *        still counted, by the reason it was closed, and @a `multiDrawCount` counts the
+   *        multi-draw calls which drew them.
+   *
+   * GPU times are only measured while GPU timing is enabled (see
+   * @a `Renderer::setGpuTimingEnabled2D`). They are read back without waiting on the graphics card,
+   * and so describe the scene drawn @a `gpuTimeLatency` scenes earlier; @a `gpuBatchTimes` has one
+   * entry, in milliseconds, per batch (or multi-draw call) of that scene. When that scene's results
+   * were not yet done and had to be discarded, the times of the last scene read back are kept, and
+   * @a `gpuTimesNew` is false.
+   */
+  struct RenderStats2D
+  {
+    Count batchCount = 0;
+    Count drawIndexCount = 0;
+    Size  uploadSize = 0;
+    Count textureBindCount = 0;
+    Count flushCounts[FLUSH_REASON_2D_COUNT] = {};
+    Count multiDrawCount = 0;
+
+    bool  gpuTimesValid = false;
+    bool  gpuTimesNew = false;
+    Count gpuTimeLatency = 0;
+    F64   gpuSceneTime = 0.0;
+    Collection<F64> gpuBatchTimes;
+
+    inline Count getFlushCount (const FlushReason2D reason) const
+      { return flushCounts[static_cast<Index>(reason)]; }
+  };
+
+  /**
+   * @brief The @a `DynamicResolutionSpecification2D` struct describes how the renderer adjusts the
+   *        render scale of its 2D framebuffer to keep each scene's GPU time near a target.
+   *
+   * A scene whose GPU time is more than @a `tolerance` (a fraction of the target) over the target is
+   * over budget, and one more than that under it is under budget. The render scale is lowered by
+   * @a `scaleStep` after @a `downscaleSceneCount` consecutive scenes over budget, and raised after
+   * @a `upscaleSceneCount` consecutive scenes under budget, so that it backs off quickly under load
+   * but only recovers once the load has clearly passed. After each change, the scenes still drawn
+   * at the old scale are skipped before counting again.
+   */
+  struct DynamicResolutionSpecification2D
+  {
+    F64   targetGpuTime = 12.0;
+    F64   tolerance = 0.1;
+    F32   minScale = 0.5f;
+    F32   maxScale = 1.0f;
+    F32   scaleStep = 0.1f;
+    Count downscaleSceneCount = 4;
+    Count upscaleSceneCount = 60;
+  };
+
+  /**
+   * @brief The @a `QuadCommand2D` struct is a quad recorded for later expansion into a batch. Its
+   *        transform is stored as the transformed X and Y axes and origin of the unit quad.
+   */
+  struct QuadCommand2D
+  {
+    Vector3f        axisX;
+    Vector3f        axisY;
+    Vector3f        origin;
+    U32             color;
+    I32             entityId;
+    Vector4<U16>    texRect;
+    Shared<Texture> texture;
+  };
+
+  /**
+   * @brief The @a `QuadTransform2D` struct is a precomputed 2D affine transform for a quad: the
+   *        images of the unit quad's X and Y axes, and of its center, whose Z coordinate is the
+   *        quad's depth.
+   */
+  struct QuadTransform2D
+  {
+    Vector2f axisX = { 1.0f, 0.0f };
+    Vector2f axisY = { 0.0f, 1.0f };
+    Vector3f origin = { 0.0f, 0.0f, 0.0f };
+
+    /**
+     * @brief Composes a @a `QuadTransform2D` which scales a quad to the given size, rotates it by
+     *        the given angle (in degrees) about its center, then moves its center to the given
+     *        position.
+     */
+    static inline QuadTransform2D fromTRS (const Vector3f& position, const Vector2f& size,
+      const F32 rotation)
+    {
+      F32 sine = std::sin(radians(rotation));
+      F32 cosine = std::cos(radians(rotation));
+
+      return {
+        { cosine * size.x, sine * size.x },
+        { -sine * size.y, cosine * size.y },
+        position
+      };
+    }
+  };
+
+  struct QuadSortEntry2D
+  {
+    U64 key;
+    U32 command;
+  };
+
+  struct TextureArrayPage2D
+  {
+    Shared<TextureArray> array = nullptr;
+    U32 usedLayerCount = 0;
+    Collection<U32> freeLayers;
+  };
+
+  struct TextureArrayEntry2D
+  {
+    Weak<Texture> texture;
+    U32 revision = 0;
+    Index page = 0;
+    U32 layer = 0;
+  };
+
+  /**
+   * @brief The @a `RetainedQuadChunk2D` struct is a fixed-size range of the renderer's retained quad
+   *        buffer, drawn with one instanced draw call. Its quads share its table of textures (or
+   *        texture array pages), which is bound to the texture slots before it is drawn. Each of
+   *        its textures counts the quads using it, and is dropped, emptying its place for reuse,
+   *        once none do. In texture array mode, each texture also keeps the texture index its quads
+   *        were written with, so that they can be rewritten if the texture moves to another layer.
+   */
+  struct RetainedQuadChunk2D
+  {
+    Collection<Shared<Texture>> textures;
+    Collection<Count> textureUseCounts;
+    Collection<I32> textureIndices;
+    Collection<Index> pages;
+    Collection<U32> quadHandles;
+    Collection<U32> freeSlots;
+    Count usedCount = 0;
+    Count liveCount = 0;
+  };
+
+  struct RetainedQuad2D
+  {
+    Index chunk = 0;
+    U32 slot = 0;
+    I32 chunkTexture = 0;
+    bool live = false;
+  };
+
+  /**
+   * @brief The @a `RenderSpecification2D` struct describes how a submitted quad is drawn. The
+   *        quad's texture coordinates span @a `texRect` (minimum U, minimum V, maximum U, maximum V)
+   *        of its texture, so that a @a `SubTexture` from a @a `TextureAtlas` can be drawn. In
+   *        deferred submission mode, quads in a lower @a `layer` are drawn first.
+   */
+  struct RenderSpecification2D
+  {
+    Vector4f color = Color::WHITE;
+    Shared<Texture> texture = nullptr;
+    I32 entityId = -1;
+    Vector4f texRect = { 0.0f, 0.0f, 1.0f, 1.0f };
+    U8 layer = 0;
+
+    inline RenderSpecification2D& setSubTexture (const SubTexture& subTexture)
+    {
+      texture = subTexture.texture;
+      texRect = subTexture.texRect;
+      return *this;
+    }
+  };
+
+  /**
+   * @brief The @a `QuadRecorder2D` class records quads for a @a `Renderer`'s 2D scene without
+   *        touching the renderer itself, so that several threads can record quads at once, each into
+   *        its own recorder. The work of transforming and packing each quad is done as it is
+   *        recorded; the renderer merges its recorders, in order, into the scene on the main thread.
+   */
+  class QuadRecorder2D
+  {
+    friend class Renderer;
+
+  public:
+    void submitQuad2D (const Matrix4f& transform, const RenderSpecification2D& spec = {});
+    void submitQuad2D (const QuadTransform2D& transform, const RenderSpecification2D& spec = {});
+    void submitQuad2D (const Vector3f& position, const Vector2f& size, const F32 rotation,
+      const RenderSpecification2D& spec = {});
+    void clear ();
+
+  public:
+    inline Count getQuadCount () const { return m_commands.size(); }
+
+  private:
+    Collection<QuadCommand2D> m_commands;
+    Collection<U64> m_keys;
+
   };
 
   struct RenderData2D
@@ -26,37 +342,87 @@ namespace dg
     static constexpr Count  QUADS_PER_BATCH = 25000;
     static constexpr Count  VERTICES_PER_BATCH = QUADS_PER_BATCH * 4;
     static constexpr Count  INDICES_PER_BATCH = QUADS_PER_BATCH * 6;
+    static constexpr Count  STREAMING_REGION_COUNT = 3;
+    static constexpr U32    ARRAY_LAYERS_INITIAL = 16;
+    static constexpr U32    ARRAY_LAYERS_MAX = 2048;
+    static constexpr Count  DEFERRED_SHADERS_MAX = 256;
+    static constexpr Count  RETAINED_QUADS_PER_CHUNK = 4096;
+    static constexpr Count  RETAINED_DIRTY_GAP = 16;
+    static constexpr Count  MULTI_DRAW_TEXTURE_UNITS_MAX = TEXTURE_UNIT_COUNT_MAX;
+    static constexpr Count  MULTI_DRAW_VERTICES_PER_REGION = VERTICES_PER_BATCH * 2;
+    static constexpr Count  MULTI_DRAW_COMMANDS_PER_REGION = 256;
 
     bool  sceneStarted = false;
     Count sceneVertexCount = 0;
     Count sceneIndexCount = 0;
-    Count sceneBatchCount = 0;
     Count batchVertexCount = 0;
     Count batchIndexCount = 0;
     Count batchTextureCount = 1;
+    Count batchArrayCount = 0;
     Count quadVertexCount = 0;
     Count quadIndexCount = 0;
+    Count quadInstanceCount = 0;
+    QuadRenderMode2D quadRenderMode = QuadRenderMode2D::BATCHED;
+    TextureBindingMode2D textureBindingMode = TextureBindingMode2D::SLOTS;
+    SubmissionMode2D submissionMode = SubmissionMode2D::IMMEDIATE;
 
-    Matrix4f cameraProduct = Matrix4f::IDENTITY;
+    RenderStats2D stats;
+    Unique<GpuTimer> gpuTimer = nullptr;
 
     Shared<Texture> blankTexture = nullptr;
     Shared<Shader> quadShader = nullptr;
+    Shared<Shader> instancedQuadShader = nullptr;
     Shared<FrameBuffer> framebuffer = nullptr;
     Shared<VertexArray> quadVertexArray = nullptr;
-    Shared<VertexBuffer> quadVertexBuffer = nullptr;
+    Shared<StreamingVertexBuffer> quadVertexBuffer = nullptr;
+    Shared<VertexArray> quadInstanceArray = nullptr;
+    Shared<VertexBuffer> quadCornerBuffer = nullptr;
+    Shared<StreamingVertexBuffer> quadInstanceBuffer = nullptr;
+    Shared<IndexBuffer> quadIndexBuffer = nullptr;
 
-    Vector4f quadVertexPositions[4];
-    Vector2f quadTexCoords[4];
-
-    Collection<QuadVertex2D> quadVertices;
+    QuadVertex2D* quadVertices = nullptr;
+    QuadInstance2D* quadInstances = nullptr;
     Collection<Shared<Texture>> textures;
-  };
 
-  struct RenderSpecification2D
-  {
-    Vector4f color = Color::WHITE;
-    Shared<Texture> texture = nullptr;
-    I32 entityId = -1;
+    Index batchArrays[TEXTURE_SLOT_COUNT];
+    Collection<TextureArrayPage2D> arrayPages;
+    Map<const Texture*, TextureArrayEntry2D> arrayEntries;
+
+    Collection<QuadCommand2D> quadCommands;
+    Collection<QuadSortEntry2D> quadSortEntries;
+    Collection<QuadSortEntry2D> quadSortScratch;
+    Collection<Shared<Shader>> deferredShaders;
+    U8 deferredShaderSlot = 0;
+
+    Collection<Unique<QuadRecorder2D>> quadRecorders;
+
+    Shared<VertexArray> retainedQuadArray = nullptr;
+    Shared<VertexBuffer> retainedQuadBuffer = nullptr;
+    Collection<QuadInstance2D> retainedInstances;
+    Collection<RetainedQuadChunk2D> retainedChunks;
+    Collection<RetainedQuad2D> retainedQuads;
+    Collection<U32> freeRetainedQuads;
+    Collection<U32> dirtyRetainedInstances;
+    Count retainedQuadCount = 0;
+    U32 retainedGeneration = 0;
+    bool retainedBufferStale = false;
+
+    bool dynamicResolutionEnabled = false;
+    DynamicResolutionSpecification2D dynamicResolution;
+    Count overBudgetSceneCount = 0;
+    Count underBudgetSceneCount = 0;
+    Count settlingSceneCount = 0;
+
+    bool multiDrawEnabled = false;
+    Count multiDrawUnitCount = 0;
+    Count multiDrawVertexStart = 0;
+    Count multiDrawCommandCount = 0;
+    Collection<Shared<Texture>> multiDrawTextures;
+    Collection<Index> multiDrawPages;
+    Shared<VertexArray> multiDrawVertexArray = nullptr;
+    Shared<StreamingVertexBuffer> multiDrawVertexBuffer = nullptr;
+    Shared<StreamingIndirectBuffer> multiDrawCommandBuffer = nullptr;
+    Shared<StreamingStorageBuffer> multiDrawTableBuffer = nullptr;
   };
 
   class Renderer
@@ -68,31 +434,172 @@ namespace dg
   public:
     static Unique<Renderer> make ();
 
+  public:
+
+    /**
+     * @brief Begins a new frame, advancing the frame uniform block's time by the given number of
+     *        seconds, setting its viewport size, and uploading it.
+     */
+    void beginFrame (const F32 deltaTime, const Vector2f& viewportSize);
+
   public:
     void useFrameBuffer2D (const Shared<FrameBuffer>& framebuffer);
+
+    /**
+     * @brief Sets the shader used to render quads. A shader created by @a `Shader::makeAsync` is
+     *        waited on if it is not ready yet; check @a `Shader::isReady` first to avoid that.
+     */
     void useQuadShader2D (const Shared<Shader>& shader);
+    void useInstancedQuadShader2D (const Shared<Shader>& shader);
+    void setQuadRenderMode2D (const QuadRenderMode2D mode);
+    void setTextureBindingMode2D (const TextureBindingMode2D mode);
+    void setSubmissionMode2D (const SubmissionMode2D mode);
+
+    /**
+     * @brief Enables or disables measuring the GPU time of each 2D scene and batch. This cannot
+     *        be changed mid-scene.
+     */
+    void setGpuTimingEnabled2D (bool enabled);
+
+    /**
+     * @brief Enables or disables multi-draw mode, in which the batches of a batched-mode scene are
+     *        written one after another into streaming buffers and drawn with one indirect
+     *        multi-draw call whenever the scene's render state changes, rather than one draw call
+     *        each. Each batch's table of textures (or texture array pages) is read by the quad
+     *        shader from the storage block at binding 0, indexed by the draw's base instance
+     *        (@a `gl_BaseInstance`), and maps the batch's texture slots onto the union of the
+     *        textures bound for the multi-draw, of which there may be
+     *        @a `MULTI_DRAW_TEXTURE_UNITS_MAX` if the graphics card has that many fragment texture
+     *        units and @a `TEXTURE_SLOT_COUNT` otherwise. This requires a quad shader written for
+     *        it (such as @a `assets/quad2d.glsl` built with @a `DG_MULTIDRAW` defined), and has no
+     *        effect in instanced mode.
+     */
+    void setMultiDrawEnabled2D (bool enabled);
+
+    /**
+     * @brief Enables or disables dynamic resolution, in which the render scale of the 2D framebuffer
+     *        (see @a `FrameBuffer::setRenderScale`) is adjusted at the start of each scene from the
+     *        measured GPU times of earlier scenes. Enabling this also enables GPU timing; disabling
+     *        it restores the framebuffer's full render scale. This cannot be changed mid-scene, and
+     *        has no effect while no framebuffer is in use.
+     */
+    void setDynamicResolutionEnabled2D (bool enabled,
+      const DynamicResolutionSpecification2D& spec = {});
 
   public:
     void beginScene2D (const Matrix4f& projection, const Matrix4f& view);
     void beginScene2D (const Matrix4f& cameraProduct);
     void endScene2D ();
-    void flushScene2D (bool early);
+    void flushScene2D (bool early, const FlushReason2D reason = FlushReason2D::MANUAL);
 
   public:
     void submitQuad2D (const Matrix4f& transform, const RenderSpecification2D& spec = {});
+    void submitQuad2D (const QuadTransform2D& transform, const RenderSpecification2D& spec = {});
     void submitQuad2D (const Vector3f& position, const Vector2f& size, const F32 rotation,
       const RenderSpecification2D& spec = {});
 
+  public:
+
+    /**
+     * @brief Ensures that this @a `Renderer` has at least the given number of quad recorders. This
+     *        must be called on the main thread, before the recorders are handed out to other threads.
+     */
+    void reserveQuadRecorders2D (const Count count);
+
+    /**
+     * @brief Retrieves the quad recorder with the given index. Each recorder must be used by only
+     *        one thread at a time.
+     */
+    QuadRecorder2D& getQuadRecorder2D (const Index index);
+
+    /**
+     * @brief Merges the quads recorded by this @a `Renderer`'s quad recorders into the current 2D
+     *        scene, in recorder index order, then clears the recorders. This happens automatically
+     *        at the end of the scene, and whenever the scene's render state changes, so all
+     *        recording must be finished before then.
+     */
+    void mergeQuadRecorders2D ();
+
+  public:
+
+    /**
+     * @brief Adds a quad to this @a `Renderer`'s retained quad buffer, which lives on the graphics
+     *        card between frames and is drawn by @a `drawRetainedQuads2D`. Only quads which are
+     *        added, updated or removed are uploaded again.
+     *
+     * @return  A handle to the retained quad, which stays valid until it is removed, or until the
+     *          retained quad buffer is cleared (see @a `getRetainedGeneration2D`).
+     */
+    Index addRetainedQuad2D (const Matrix4f& transform, const RenderSpecification2D& spec = {});
+    void updateRetainedQuad2D (const Index handle, const Matrix4f& transform,
+      const RenderSpecification2D& spec = {});
+    void removeRetainedQuad2D (const Index handle);
+    void clearRetainedQuads2D ();
+
+    /**
+     * @brief Draws every retained quad into the current 2D scene with the instanced quad shader,
+     *        one draw call per retained chunk, after uploading any retained quads which changed.
+     */
+    void drawRetainedQuads2D ();
+
   private:
+    void uploadFrameUniforms ();
+    void resetStats2D ();
+    void updateRenderScale2D ();
+    void submitQuadCommand2D (QuadCommand2D&& command, const U8 layer);
+    void emitQuad2D (const QuadCommand2D& command);
     void submitQuadVertex2D (const QuadVertex2D& vertex);
+    void submitQuadInstance2D (const QuadInstance2D& instance);
+    void acquireQuadRegion2D ();
     Index slotTexture2D (const Shared<Texture>& texture);
+    I32 slotTextureLayer2D (const Shared<Texture>& texture);
+    Index allocateTextureLayer2D (const Texture& texture, U32& layer);
+    void sweepTextureLayers2D ();
+    void slotDeferredShader2D ();
+    void sortQuadCommands2D ();
+    void drainQuadCommands2D ();
+    void resolveTextureLayer2D (const Shared<Texture>& texture, Index& page, U32& layer);
+    Index placeRetainedQuad2D (const Index handle, const Shared<Texture>& texture, I32& texIndex);
+    void releaseRetainedQuad2D (const Index handle);
+    void useRetainedTextureSlot2D (RetainedQuadChunk2D& chunk, const I32 chunkTexture);
+    void releaseRetainedTextureSlot2D (RetainedQuadChunk2D& chunk, const I32 chunkTexture);
+    bool bindRetainedTexture2D (RetainedQuadChunk2D& chunk, const Shared<Texture>& texture,
+      I32& texIndex, I32& chunkTexture);
+    void refreshRetainedChunk2D (const Index chunkIndex);
+    void writeRetainedQuad2D (const Index instance, const QuadCommand2D& command,
+      const I32 texIndex);
+    void uploadRetainedQuads2D ();
+    bool hasPendingQuads2D () const;
+    bool isMultiDrawActive2D () const;
+    void closeMultiDraw2D ();
+    bool mapMultiDrawTable2D ();
+    void submitMultiDraw2D ();
+    void releaseMultiDrawRegion2D ();
 
   public:
     inline Count getVertexCount2D () const { return m_renderData2D.sceneVertexCount; }
     inline Count getIndexCount2D () const { return m_renderData2D.sceneIndexCount; }
-    inline Count getBatchCount2D () const { return m_renderData2D.sceneBatchCount; }
+    inline Count getBatchCount2D () const { return m_renderData2D.stats.batchCount; }
+    inline Count getDrawIndexCount2D () const { return m_renderData2D.stats.drawIndexCount; }
+    inline Size getUploadSize2D () const { return m_renderData2D.stats.uploadSize; }
+    inline const RenderStats2D& getStats2D () const { return m_renderData2D.stats; }
+    inline bool isGpuTimingEnabled2D () const { return m_renderData2D.gpuTimer != nullptr; }
+    inline bool isMultiDrawEnabled2D () const { return m_renderData2D.multiDrawEnabled; }
+    inline bool isDynamicResolutionEnabled2D () const
+      { return m_renderData2D.dynamicResolutionEnabled; }
+    inline QuadRenderMode2D getQuadRenderMode2D () const { return m_renderData2D.quadRenderMode; }
+    inline TextureBindingMode2D getTextureBindingMode2D () const
+      { return m_renderData2D.textureBindingMode; }
+    inline SubmissionMode2D getSubmissionMode2D () const
+      { return m_renderData2D.submissionMode; }
+    inline Count getQuadRecorderCount2D () const { return m_renderData2D.quadRecorders.size(); }
+    inline Count getRetainedQuadCount2D () const { return m_renderData2D.retainedQuadCount; }
+    inline U32 getRetainedGeneration2D () const { return m_renderData2D.retainedGeneration; }
+    inline const FrameUniforms& getFrameUniforms () const { return m_frameUniforms; }
 
   private:
+    FrameUniforms m_frameUniforms;
+    Shared<UniformBuffer> m_frameUniformBuffer = nullptr;
     RenderData2D m_renderData2D;
 
   };
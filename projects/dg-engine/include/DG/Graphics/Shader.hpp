@@ -4,10 +4,39 @@
 
 #include <DG_Pch.hpp>
 #include <DG/Math/Matrix4.hpp>
+#include <DG/Graphics/ShaderPreprocessor.hpp>
 
 namespace dg
 {
 
+  /**
+   * @brief The @a `UniformHandle` struct is the location of one of a shader's uniforms, found once
+   *        by name with @a `Shader::findUniform`, so that the uniform can be set again and again
+   *        without being looked up. Setting a uniform through an invalid handle does nothing.
+   *
+   * A handle also names the program it was found in, and only sets uniforms on that program: a
+   * handle passed to another shader, or kept across a rebuild of its own, throws in debug builds and
+   * does nothing otherwise.
+   */
+  struct UniformHandle
+  {
+    I32 location = -1;
+    U32 program = 0;
+
+    inline bool isValid () const { return location != -1; }
+  };
+
+  /**
+   * @brief The @a `ShaderSpecification` struct describes one permutation of a shader file: the file,
+   *        the defines it is built with, and whether it is built asynchronously.
+   */
+  struct ShaderSpecification
+  {
+    Path path = "";
+    ShaderDefines defines = {};
+    bool async = false;
+  };
+
   class Shader
   {
   protected:
@@ -20,10 +49,60 @@ namespace dg
     static Shared<Shader> make (const Path& path);
     static Shared<Shader> make (const String& vertexCode, const String& fragmentCode);
 
+    /**
+     * @brief Creates the permutation of a shader file described by the given specification. Each
+     *        permutation is built only once per process: while any user still holds it, creating
+     *        it again returns the same shader, whatever order its defines were given in.
+     */
+    static Shared<Shader> make (const ShaderSpecification& spec);
+
+    /**
+     * @brief Creates a shader whose program is built in the background where the graphics API
+     *        supports it, instead of blocking until it is built. The shader is not ready until it
+     *        is polled, waited on, or picked up by @a `pollPending`.
+     */
+    static Shared<Shader> makeAsync (const Path& path);
+    static Shared<Shader> makeAsync (const String& vertexCode, const String& fragmentCode);
+
+    /**
+     * @brief Polls every shader created by @a `makeAsync` which is not ready yet, finishing those
+     *        whose programs have been built. This is called once per frame by the application.
+     */
+    static void pollPending ();
+
+    /**
+     * @brief Sets the directory in which linked shader programs are cached, where the graphics API
+     *        supports it, so that later launches can load them instead of compiling their source.
+     *        Cached programs are keyed by their source code and by the graphics driver, and are
+     *        rebuilt if the driver rejects them. If the directory is empty, nothing is cached.
+     */
+    static inline void setProgramCacheDirectory (const Path& directory)
+      { s_programCacheDirectory = directory; }
+    static inline const Path& getProgramCacheDirectory () { return s_programCacheDirectory; }
+
   public:
     virtual void bind () const = 0;
     virtual void unbind () const = 0;
 
+    /**
+     * @brief Finishes building the shader if its program has been built, without blocking.
+     *        Returns whether the shader is now ready.
+     */
+    virtual bool poll () = 0;
+
+    /**
+     * @brief Blocks until the shader's program has been built, then finishes building the shader.
+     */
+    virtual void wait () = 0;
+
+  public:
+
+    /**
+     * @brief Finds the uniform with the given name. An array uniform can be found by its bare name,
+     *        which refers to its first element, or by the name of any one of its elements.
+     */
+    virtual UniformHandle findUniform (const String& name) const = 0;
+
   public:
     virtual bool setInteger (const String&, I32) = 0;
     virtual bool setUnsignedInteger (const String&, U32) = 0;
@@ -57,11 +136,61 @@ namespace dg
     virtual bool setMatrix3d (const String&, const Matrix3d&) = 0;
     virtual bool setMatrix4d (const String&, const Matrix4d&) = 0;
 
+  public:
+    virtual bool setInteger (UniformHandle, I32) = 0;
+    virtual bool setUnsignedInteger (UniformHandle, U32) = 0;
+    virtual bool setFloat (UniformHandle, F32) = 0;
+    virtual bool setDouble (UniformHandle, F64) = 0;
+    virtual bool setBoolean (UniformHandle, bool) = 0;
+
+    virtual bool setVector2i (UniformHandle, const Vector2i&) = 0;
+    virtual bool setVector2u (UniformHandle, const Vector2u&) = 0;
+    virtual bool setVector2f (UniformHandle, const Vector2f&) = 0;
+    virtual bool setVector2d (UniformHandle, const Vector2d&) = 0;
+    virtual bool setVector2b (UniformHandle, const Vector2b&) = 0;
+
+    virtual bool setVector3i (UniformHandle, const Vector3i&) = 0;
+    virtual bool setVector3u (UniformHandle, const Vector3u&) = 0;
+    virtual bool setVector3f (UniformHandle, const Vector3f&) = 0;
+    virtual bool setVector3d (UniformHandle, const Vector3d&) = 0;
+    virtual bool setVector3b (UniformHandle, const Vector3b&) = 0;
+
+    virtual bool setVector4i (UniformHandle, const Vector4i&) = 0;
+    virtual bool setVector4u (UniformHandle, const Vector4u&) = 0;
+    virtual bool setVector4f (UniformHandle, const Vector4f&) = 0;
+    virtual bool setVector4d (UniformHandle, const Vector4d&) = 0;
+    virtual bool setVector4b (UniformHandle, const Vector4b&) = 0;
+
+    virtual bool setMatrix2f (UniformHandle, const Matrix2f&) = 0;
+    virtual bool setMatrix3f (UniformHandle, const Matrix3f&) = 0;
+    virtual bool setMatrix4f (UniformHandle, const Matrix4f&) = 0;
+
+    virtual bool setMatrix2d (UniformHandle, const Matrix2d&) = 0;
+    virtual bool setMatrix3d (UniformHandle, const Matrix3d&) = 0;
+    virtual bool setMatrix4d (UniformHandle, const Matrix4d&) = 0;
+
+    /**
+     * @brief Sets the given number of consecutive elements of an array uniform, starting with the
+     *        element the given handle refers to. Values past the end of the array are ignored.
+     */
+    virtual bool setIntegerArray (UniformHandle, const I32* values, const Count count) = 0;
+
   public:
     inline bool isValid () const { return m_valid; }
+    inline bool isReady () const { return m_ready; }
+
+  protected:
+    static Shared<Shader> makePermutation (const Path& path, const ShaderDefines& defines,
+      bool async);
+
+  protected:
+    static inline Path s_programCacheDirectory = "";
+    static inline Dictionary<Weak<Shader>> s_permutations;
+    static inline Collection<Weak<Shader>> s_pendingShaders;
 
   protected:
     bool m_valid = false;
+    bool m_ready = false;
 
   };
 
@@ -0,0 +1,70 @@
+/** @file DG/Graphics/ShaderPreprocessor.hpp */
+
+#pragma once
+
+#include <DG_Pch.hpp>
+
+namespace dg
+{
+
+  /**
+   * @brief A set of preprocessor definitions selecting one permutation of a shader. Each is either
+   *        a bare name, such as @a `DG_ARRAYS`, or a name and value, such as
+   *        @a `DG_ALPHA_CUTOFF=0.25`.
+   */
+  using ShaderDefines = Collection<String>;
+
+  /**
+   * @brief The @a `ShaderSource` struct holds the preprocessed source code of each of a shader's
+   *        stages.
+   */
+  struct ShaderSource
+  {
+    String vertexCode = "";
+    String fragmentCode = "";
+
+    /**
+     * @brief The files the stages were loaded from, indexed by the source string numbers which
+     *        the GLSL compiler reports errors against. The shader file itself is the first.
+     */
+    Collection<Path> sourceFiles = {};
+  };
+
+  /**
+   * @brief The @a `ShaderPreprocessor` class loads a shader file into the source code of its
+   *        stages.
+   *
+   * A shader file is split into stages by @a `#shader vertex` and @a `#shader fragment` directives.
+   * Within a stage, an @a `#include "name"` directive is replaced by the contents of the named
+   * file, found relative to the including file. Each file is included at most once per stage, so
+   * shared files need no include guards, and include cycles end on their own. Conditional blocks
+   * are evaluated against the requested defines and the stage's own @a `#define` directives, and an
+   * include is only expanded, and only counts as included, in a block which is kept. An @a `#if`
+   * may only combine @a `defined(NAME)` and comparisons of integer literals and macros with
+   * @a `!`, @a `&&`, @a `||` and parentheses; anything else fails the load. The conditional
+   * directives themselves are left in place for the GLSL preprocessor. Each of the requested
+   * defines is inserted into every stage as a @a `#define` directive, just after its
+   * @a `#version` directive, along with @a `DG_TEXTURE_SLOT_COUNT` and
+   * @a `DG_FRAGMENT_TEXTURE_UNITS`, the number of texture units a fragment shader can sample.
+   * @a `#line` directives are inserted after the defines and around each include, so that the
+   * GLSL compiler's errors name the right line of the right file.
+   */
+  class ShaderPreprocessor
+  {
+  public:
+
+    /**
+     * @brief Loads and preprocesses the shader file at the given path with the given defines.
+     *        Returns whether the file and everything it includes were loaded.
+     */
+    static bool load (const Path& path, const ShaderDefines& defines, ShaderSource& source);
+
+    /**
+     * @brief Returns a key which identifies the permutation of the shader file at the given path
+     *        with the given defines, regardless of the order the defines are in.
+     */
+    static String getPermutationKey (const Path& path, const ShaderDefines& defines);
+
+  };
+
+}
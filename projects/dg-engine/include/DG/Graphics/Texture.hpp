@@ -7,8 +7,17 @@
 namespace dg
 {
 
+  class PixelUploadBuffer;
+
   constexpr Count TEXTURE_SLOT_COUNT = 16;
 
+  /**
+   * @brief The number of texture units which textures may be bound to. Only the first
+   *        @a `TEXTURE_SLOT_COUNT` of them are used by a single batch of quads; the rest are used
+   *        when several batches are drawn together.
+   */
+  constexpr Count TEXTURE_UNIT_COUNT_MAX = 32;
+
   enum class TextureWrapMode
   {
     REPEAT,
@@ -47,6 +56,30 @@ namespace dg
     virtual void bind (const Index slot = 0) const = 0;
     virtual void unbind (const Index slot = 0) const = 0;
     virtual void upload (const void*, const Size) = 0;
+
+    /**
+     * @brief Uploads pixel data into the rectangular region of this @a `Texture` with the given
+     *        offset and size. The data must be tightly packed, in this texture's format.
+     */
+    virtual void uploadRegion (const Vector2i& offset, const Vector2i& size, const void*,
+      const Size) = 0;
+
+    /**
+     * @brief Uploads pixel data into the rectangular region of this @a `Texture` with the given
+     *        offset and size, from the given pixel upload buffer's acquired region, starting the
+     *        given number of bytes into it. The data must be tightly packed, in this texture's
+     *        format.
+     */
+    virtual void uploadRegion (const Vector2i& offset, const Vector2i& size,
+      const PixelUploadBuffer& buffer, const Size bufferOffset) = 0;
+
+    /**
+     * @brief Swaps this texture's storage, along with its size and format, with the given
+     *        texture's, which must come from the same graphics backend. The revisions of both
+     *        textures are advanced.
+     */
+    virtual void swapStorage (Texture& other) = 0;
+
     virtual void* getPointer () const = 0;
 
   public:
@@ -54,6 +87,7 @@ namespace dg
 
   public:
     inline bool isValid () const { return m_valid; }
+    inline U32 getRevision () const { return m_revision; }
     inline const Vector2i& getSize () const { return m_size; }
     inline I32 getColorChannelCount () const { return m_colorChannelCount; }
     inline TextureWrapMode getWrapMode () const { return m_wrap; }
@@ -63,11 +97,87 @@ namespace dg
   protected:
     virtual bool initializeTexture () = 0;
     virtual bool onImageDataLoaded (const void*) = 0;
+    void swapProperties (Texture& other);
 
   protected:
     bool m_valid = false;
+    U32 m_revision = 0;
+    Vector2i m_size;
+    I32 m_colorChannelCount;
+    TextureWrapMode m_wrap;
+    TextureFilterMode m_magnify;
+    TextureFilterMode m_minify;
+
+  };
+
+  struct TextureArraySpecification
+  {
+    Vector2i size = { 1, 1 };
+    I32 colorChannelCount = 4;
+    U32 layerCount = 16;
+    TextureWrapMode wrap = TextureWrapMode::REPEAT;
+    TextureFilterMode magnify = TextureFilterMode::NEAREST;
+    TextureFilterMode minify = TextureFilterMode::NEAREST;
+  };
+
+  /**
+   * @brief The @a `TextureArray` class is an array of equally-sized, equally-formatted texture
+   *        layers, all bound to a single texture slot. Textures whose properties match the array's
+   *        can be copied into its layers on the graphics card.
+   */
+  class TextureArray
+  {
+  protected:
+    TextureArray (const TextureArraySpecification& spec) :
+      m_size { spec.size },
+      m_colorChannelCount { spec.colorChannelCount },
+      m_layerCount { spec.layerCount },
+      m_wrap { spec.wrap },
+      m_magnify { spec.magnify },
+      m_minify { spec.minify }
+    {}
+
+  public:
+    virtual ~TextureArray () = default;
+
+  public:
+    static Shared<TextureArray> make (const TextureArraySpecification& spec = {});
+
+  public:
+    virtual void bind (const Index slot = 0) const = 0;
+    virtual void unbind (const Index slot = 0) const = 0;
+    virtual void uploadLayer (const U32 layer, const void*, const Size) = 0;
+    virtual void copyLayer (const U32 layer, const Texture& texture) = 0;
+
+    /**
+     * @brief Grows this @a `TextureArray` to hold at least the given number of layers. The contents
+     *        of the existing layers are preserved.
+     */
+    virtual void reserve (const U32 layerCount) = 0;
+
+  public:
+    inline bool isCompatible (const Texture& texture) const
+    {
+      return (
+        texture.getSize() == m_size &&
+        texture.getColorChannelCount() == m_colorChannelCount &&
+        texture.getWrapMode() == m_wrap &&
+        texture.getMagnifyFilterMode() == m_magnify &&
+        texture.getMinifyFilterMode() == m_minify
+      );
+    }
+
+    inline const Vector2i& getSize () const { return m_size; }
+    inline I32 getColorChannelCount () const { return m_colorChannelCount; }
+    inline U32 getLayerCount () const { return m_layerCount; }
+    inline TextureWrapMode getWrapMode () const { return m_wrap; }
+    inline TextureFilterMode getMagnifyFilterMode () const { return m_magnify; }
+    inline TextureFilterMode getMinifyFilterMode () const { return m_minify; }
+
+  protected:
     Vector2i m_size;
     I32 m_colorChannelCount;
+    U32 m_layerCount;
     TextureWrapMode m_wrap;
     TextureFilterMode m_magnify;
     TextureFilterMode m_minify;
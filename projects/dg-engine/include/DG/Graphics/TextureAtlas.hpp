@@ -0,0 +1,76 @@
+/** @file DG/Graphics/TextureAtlas.hpp */
+
+#pragma once
+
+#include <DG/Math/Vector4.hpp>
+#include <DG/Graphics/Texture.hpp>
+
+namespace dg
+{
+
+  /**
+   * @brief The @a `SubTexture` struct refers to a rectangular region of a texture, such as an image
+   *        packed into a texture atlas' page. The region's texture coordinates are stored in
+   *        @a `texRect` as minimum U, minimum V, maximum U and maximum V, in that order.
+   */
+  struct SubTexture
+  {
+    Shared<Texture> texture = nullptr;
+    Vector4f texRect = { 0.0f, 0.0f, 1.0f, 1.0f };
+    Vector2i size = { 0, 0 };
+
+    inline bool isValid () const { return texture != nullptr; }
+  };
+
+  struct TextureAtlasSpecification
+  {
+    Vector2i pageSize = { 2048, 2048 };
+    I32 padding = 1;
+    I32 extrude = 1;
+    TextureFilterMode magnify = TextureFilterMode::NEAREST;
+    TextureFilterMode minify = TextureFilterMode::NEAREST;
+  };
+
+  struct TextureAtlasPage;
+
+  /**
+   * @brief The @a `TextureAtlas` class packs images into large RGBA texture pages at runtime, so
+   *        that quads drawn with many different images share only a few textures.
+   *
+   * Images can be inserted at any time; each is placed into the first page with room for it, and a
+   * new page is created when none has. Each image is surrounded by @a `extrude` copies of its edge
+   * pixels, which keep filtering from sampling its neighbours, then by @a `padding` transparent
+   * pixels.
+   */
+  class TextureAtlas
+  {
+  public:
+    TextureAtlas (const TextureAtlasSpecification& spec = {});
+    ~TextureAtlas ();
+
+  public:
+    static Unique<TextureAtlas> make (const TextureAtlasSpecification& spec = {});
+
+  public:
+    SubTexture insert (const void* data, const Vector2i& size, const I32 colorChannelCount = 4);
+    SubTexture insert (const Path& path);
+    SubTexture find (const Path& path) const;
+    void clear ();
+
+  public:
+    inline Count getPageCount () const { return m_pages.size(); }
+    inline const Vector2i& getPageSize () const { return m_pageSize; }
+    Shared<Texture> getPage (const Index index) const;
+
+  private:
+    Vector2i m_pageSize;
+    I32 m_padding;
+    I32 m_extrude;
+    TextureFilterMode m_magnify;
+    TextureFilterMode m_minify;
+    Collection<Unique<TextureAtlasPage>> m_pages;
+    Map<String, SubTexture> m_pathSubTextures;
+
+  };
+
+}
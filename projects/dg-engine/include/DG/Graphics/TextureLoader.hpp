@@ -0,0 +1,85 @@
+/** @file DG/Graphics/TextureLoader.hpp */
+
+#pragma once
+
+#include <DG/Core/ThreadPool.hpp>
+#include <DG/Graphics/GraphicsBuffers.hpp>
+#include <DG/Graphics/Texture.hpp>
+
+namespace dg
+{
+
+  struct TextureLoadRequest;
+
+  struct TextureLoaderSpecification
+  {
+
+    /**
+     * @brief The most bytes of pixel data streamed to the graphics card per update. This is also
+     *        the size of each region of the loader's pixel upload buffer.
+     */
+    Size uploadBudget = 8 * 1024 * 1024;
+
+    /**
+     * @brief The number of regions in the loader's pixel upload buffer, and so the number of
+     *        updates' uploads which may be in flight on the graphics card at once.
+     */
+    Count regionCount = 3;
+
+  };
+
+  /**
+   * @brief The @a `TextureLoader` class loads textures from image files without stalling the
+   *        calling thread.
+   *
+   * A texture requested with @a `load` is returned right away, holding a single white texel. Its
+   * image file is decoded on the thread pool, and each @a `update` streams decoded pixels into a
+   * separate texture through a pixel upload buffer, a bounded number of bytes at a time, so that
+   * even a large image is spread over several frames. Once all of an image's pixels are on the
+   * graphics card, that texture's storage is swapped into the returned texture, whose revision
+   * then advances. If an image cannot be loaded, its texture stays white.
+   */
+  class TextureLoader
+  {
+  public:
+    TextureLoader (ThreadPool& threadPool, const TextureLoaderSpecification& spec = {});
+    ~TextureLoader ();
+
+  public:
+    static Unique<TextureLoader> make (ThreadPool& threadPool,
+      const TextureLoaderSpecification& spec = {});
+
+  public:
+
+    /**
+     * @brief Starts loading the image file at the given path into a new texture, which is returned
+     *        right away. The image's size and color channel count replace those of the given
+     *        specification once it is loaded.
+     */
+    Shared<Texture> load (const Path& path, const TextureSpecification& spec = {});
+
+    /**
+     * @brief Streams up to the upload budget's worth of decoded pixels to the graphics card, and
+     *        finishes every texture whose pixels have all been uploaded. This is called once per
+     *        frame by the application.
+     */
+    void update ();
+
+    /**
+     * @brief Blocks until every texture requested so far has finished loading.
+     */
+    void finish ();
+
+  public:
+    inline Count getPendingCount () const { return m_requests.size(); }
+    inline Size getUploadBudget () const { return m_uploadBudget; }
+
+  private:
+    ThreadPool& m_threadPool;
+    Shared<PixelUploadBuffer> m_uploadBuffer = nullptr;
+    std::deque<Shared<TextureLoadRequest>> m_requests;
+    Size m_uploadBudget = 0;
+
+  };
+
+}
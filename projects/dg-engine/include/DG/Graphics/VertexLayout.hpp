@@ -37,7 +37,10 @@ namespace dg
     Float3x3, 
     Double3x3, 
     Float4x4, 
-    Double4x4
+    Double4x4,
+    Ushort2,
+    Ushort4,
+    Ubyte4
   };
 
   /**
@@ -54,11 +57,14 @@ namespace dg
      * @param name        A string identifying the vertex attribute.
      * @param type        The type of the vertex attribute's value(s).
      * @param normalized  Should the vertex attribute's value(s) be normalized into a unit range?
+     * @param divisor     The number of instances drawn before this attribute advances, or zero if
+     *                    it advances once per vertex.
      */
     VertexAttribute (
       const String& name,
       const VertexAttributeType type,
-      bool normalized = false
+      bool normalized = false,
+      U32 divisor = 0
     );
 
     /**
@@ -76,6 +82,14 @@ namespace dg
      */
     Size getElementCount () const;
 
+    /**
+     * @brief Determines whether this @a `VertexAttribute`'s value(s) reach the shader as integers.
+     *        This is the case for attributes of an integer type which are not normalized.
+     * 
+     * @return  True if this @a `VertexAttribute` is an integer attribute; false otherwise.
+     */
+    bool isInteger () const;
+
     /**
      * @brief A string identifying the vertex attribute.
      */
@@ -92,6 +106,13 @@ namespace dg
      */
     bool normalized;
 
+    /**
+     * @brief The number of instances drawn before this vertex attribute advances to its next value.
+     *        A divisor of zero advances the attribute once per vertex; a divisor of one advances it
+     *        once per instance.
+     */
+    U32 divisor;
+
     /**
      * @brief The position, in bytes, of the vertex attribute relative to the starting point of the
      *        vertex on the graphics card.
@@ -105,6 +126,7 @@ namespace dg
     return (
       lhs.type == rhs.type &&
       lhs.normalized == rhs.normalized &&
+      lhs.divisor == rhs.divisor &&
       lhs.offset == rhs.offset
     );
   }
@@ -114,6 +136,7 @@ namespace dg
     return (
       lhs.type != rhs.type ||
       lhs.normalized != rhs.normalized ||
+      lhs.divisor != rhs.divisor ||
       lhs.offset != rhs.offset
     );
   }
@@ -33,6 +33,14 @@ namespace dg
     else { return number; }
   }
 
+  /**
+   * @brief Packs the given number, clamped to [0, 1], into a normalized 16-bit integer.
+   */
+  inline U16 packUnorm16 (F32 number)
+  {
+    return static_cast<U16>(clamp(number, 0.0f, 1.0f) * 65535.0f + 0.5f);
+  }
+
   template <typename T>
   inline bool floatEquals (T lhs, T rhs)
   {
@@ -0,0 +1,43 @@
+/** @file DG/Null/NullFrameBuffer.hpp */
+
+#pragma once
+
+#if !defined(DG_USING_NULL_GRAPHICS)
+  #error "Do not #include this file if you are not using the null graphics backend!"
+#endif
+
+#include <DG/Graphics/FrameBuffer.hpp>
+
+namespace dg::Null
+{
+
+  class FrameBufferImpl : public FrameBuffer
+  {
+  public:
+    FrameBufferImpl (const FrameBufferSpecification& spec);
+    ~FrameBufferImpl () = default;
+
+  public:
+    void bind (FrameBufferBindTarget target = FrameBufferBindTarget::DRAW) const override;
+    void unbind (FrameBufferBindTarget target = FrameBufferBindTarget::DRAW) const override;
+    U32 getColorHandle (const Index index = 0) const override;
+    U32 getDepthHandle () const override;
+    void* getColorPointer (const Index index = 0) const override;
+    I32 readPixelI32 (const Index index, const Vector2i& position) const override;
+    I32 readPixelI32 (const Index index, const Vector2f& position) const override;
+    bool pollReadbacks (const bool wait = false) override;
+
+  private:
+    void onAllocatedSizeChanged () override;
+    void beginReadback (const Shared<FrameBufferReadback>& readback) override;
+    void build ();
+
+  private:
+    U32 m_handle = 0;
+    Collection<U32> m_colorHandles;
+    U32 m_depthHandle = 0;
+    Collection<Shared<FrameBufferReadback>> m_readbacks;
+
+  };
+
+}
@@ -0,0 +1,36 @@
+/** @file DG/Null/NullGpuTimer.hpp */
+
+#pragma once
+
+#if !defined(DG_USING_NULL_GRAPHICS)
+  #error "Do not #include this file if you are not using the null graphics backend!"
+#endif
+
+#include <DG/Graphics/GpuTimer.hpp>
+
+namespace dg::Null
+{
+
+  /**
+   * @brief The null backend's @a `GpuTimerImpl` records its queries, but never has any results.
+   */
+  class GpuTimerImpl : public GpuTimer
+  {
+  public:
+    GpuTimerImpl (const Count latency);
+    ~GpuTimerImpl () = default;
+
+  public:
+    void beginFrame () override;
+    void endFrame () override;
+    void beginRange () override;
+    void endRange () override;
+    Count getLatency () const override;
+
+  private:
+    U32 m_handle = 0;
+    Count m_latency = 0;
+
+  };
+
+}
@@ -0,0 +1,202 @@
+/** @file DG/Null/NullGraphicsBuffers.hpp */
+
+#pragma once
+
+#if !defined(DG_USING_NULL_GRAPHICS)
+  #error "Do not #include this file if you are not using the null graphics backend!"
+#endif
+
+#include <DG/Graphics/GraphicsBuffers.hpp>
+
+namespace dg::Null
+{
+
+  class VertexBufferImpl : public VertexBuffer
+  {
+  public:
+    VertexBufferImpl (const void* data, const Size size, bool dynamic = false);
+    VertexBufferImpl (const Size size);
+    ~VertexBufferImpl () = default;
+
+  public:
+    void bind () const override;
+    void unbind () const override;
+    void upload (const void* data, const Size size) override;
+    void uploadRange (const void* data, const Size size, const Size offset) override;
+
+  public:
+    inline U32 getHandle () const { return m_handle; }
+
+  private:
+    U32 m_handle = 0;
+
+  };
+
+  /**
+   * @brief The null backend's @a `StreamingVertexBufferImpl` maps its regions onto client memory,
+   *        which is never fenced, so vertices written into it cost what they would with a graphics
+   *        card that never falls behind.
+   */
+  class StreamingVertexBufferImpl : public StreamingVertexBuffer
+  {
+  public:
+    StreamingVertexBufferImpl (const Size regionSize, const Count regionCount);
+    ~StreamingVertexBufferImpl () = default;
+
+  public:
+    void bind () const override;
+    void unbind () const override;
+    void upload (const void* data, const Size size) override;
+    void uploadRange (const void* data, const Size size, const Size offset) override;
+    void* acquireRegion () override;
+    void releaseRegion () override;
+
+  public:
+    inline U32 getHandle () const { return m_handle; }
+
+  private:
+    U32 m_handle = 0;
+    Collection<U8> m_mapping;
+
+  };
+
+  class IndexBufferImpl : public IndexBuffer
+  {
+  public:
+    IndexBufferImpl (const Collection<U32>& indices, bool dynamic = false);
+    IndexBufferImpl (const Count count);
+    ~IndexBufferImpl () = default;
+
+  public:
+    void bind () const override;
+    void unbind () const override;
+
+  public:
+    inline U32 getHandle () const { return m_handle; }
+
+  private:
+    U32 m_handle = 0;
+
+  };
+
+  class IndirectBufferImpl : public IndirectBuffer
+  {
+  public:
+    IndirectBufferImpl (const Count commandCount);
+    ~IndirectBufferImpl () = default;
+
+  public:
+    void bind () const override;
+    void unbind () const override;
+    void upload (const DrawIndexedIndirectCommand* commands, const Count count) override;
+
+  public:
+    inline U32 getHandle () const { return m_handle; }
+
+  private:
+    U32 m_handle = 0;
+
+  };
+
+  class StreamingIndirectBufferImpl : public StreamingIndirectBuffer
+  {
+  public:
+    StreamingIndirectBufferImpl (const Count regionCommandCount, const Count regionCount);
+    ~StreamingIndirectBufferImpl () = default;
+
+  public:
+    void bind () const override;
+    void unbind () const override;
+    void upload (const DrawIndexedIndirectCommand* commands, const Count count) override;
+    DrawIndexedIndirectCommand* acquireRegion () override;
+    void releaseRegion () override;
+
+  public:
+    inline U32 getHandle () const { return m_handle; }
+
+  private:
+    U32 m_handle = 0;
+    Collection<DrawIndexedIndirectCommand> m_mapping;
+
+  };
+
+  class StorageBufferImpl : public StorageBuffer
+  {
+  public:
+    StorageBufferImpl (const Size size);
+    ~StorageBufferImpl () = default;
+
+  public:
+    void bind (const Index binding) const override;
+    void unbind (const Index binding) const override;
+    void upload (const void* data, const Size size) override;
+
+  public:
+    inline U32 getHandle () const { return m_handle; }
+
+  private:
+    U32 m_handle = 0;
+
+  };
+
+  class StreamingStorageBufferImpl : public StreamingStorageBuffer
+  {
+  public:
+    StreamingStorageBufferImpl (const Size regionSize, const Count regionCount);
+    ~StreamingStorageBufferImpl () = default;
+
+  public:
+    void bind (const Index binding) const override;
+    void unbind (const Index binding) const override;
+    void upload (const void* data, const Size size) override;
+    void* acquireRegion () override;
+    void releaseRegion () override;
+
+  public:
+    inline U32 getHandle () const { return m_handle; }
+
+  private:
+    U32 m_handle = 0;
+    Collection<U8> m_mapping;
+
+  };
+
+  class UniformBufferImpl : public UniformBuffer
+  {
+  public:
+    UniformBufferImpl (const Size size);
+    ~UniformBufferImpl () = default;
+
+  public:
+    void bind (const Index binding) const override;
+    void unbind (const Index binding) const override;
+    void upload (const void* data, const Size size) override;
+
+  public:
+    inline U32 getHandle () const { return m_handle; }
+
+  private:
+    U32 m_handle = 0;
+
+  };
+
+  class PixelUploadBufferImpl : public PixelUploadBuffer
+  {
+  public:
+    PixelUploadBufferImpl (const Size regionSize, const Count regionCount);
+    ~PixelUploadBufferImpl () = default;
+
+  public:
+    void* acquireRegion () override;
+    void releaseRegion () override;
+
+  public:
+    inline U32 getHandle () const { return m_handle; }
+
+  private:
+    U32 m_handle = 0;
+    Collection<U8> m_mapping;
+
+  };
+
+}
@@ -0,0 +1,96 @@
+/** @file DG/Null/NullRecorder.hpp */
+
+#pragma once
+
+#if !defined(DG_USING_NULL_GRAPHICS)
+  #error "Do not #include this file if you are not using the null graphics backend!"
+#endif
+
+#include <DG_Pch.hpp>
+
+namespace dg::Null
+{
+
+  enum class CommandType
+  {
+    CLEAR,
+    SET_CLEAR_COLOR,
+    SET_VIEWPORT,
+    DRAW_INDEXED,
+    DRAW_INDEXED_INSTANCED,
+    MULTI_DRAW_INDEXED_INDIRECT,
+    CREATE_BUFFER,
+    UPLOAD_BUFFER,
+    ACQUIRE_REGION,
+    RELEASE_REGION,
+    CREATE_VERTEX_ARRAY,
+    BIND_VERTEX_ARRAY,
+    CREATE_SHADER,
+    BIND_SHADER,
+    SET_UNIFORM,
+    CREATE_TEXTURE,
+    BIND_TEXTURE,
+    UPLOAD_TEXTURE,
+    COPY_TEXTURE,
+    CREATE_FRAMEBUFFER,
+    BIND_FRAMEBUFFER,
+    UNBIND_FRAMEBUFFER,
+    READ_PIXELS,
+    TIMER_QUERY
+  };
+
+  constexpr Count COMMAND_TYPE_COUNT = 24;
+
+  /**
+   * @brief The @a `Command` struct is one command recorded by the null graphics backend. The
+   *        @a `object` is the handle of the object the command acted on, and the meaning of the
+   *        @a `arguments` depends on the command's type (for example, the index count, base vertex
+   *        and instance count of a draw command).
+   */
+  struct Command
+  {
+    CommandType type;
+    U32 object;
+    I64 arguments[4];
+    Size byteCount;
+  };
+
+  /**
+   * @brief The @a `Recorder` class collects the commands issued to the null graphics backend, in
+   *        place of a graphics card. Every command is counted, along with the bytes it would have
+   *        sent to the graphics card; while the command stream is enabled, every command is also
+   *        appended to it, in order.
+   */
+  class Recorder
+  {
+  public:
+    static U32 generateHandle ();
+    static void record (const CommandType type, const U32 object, const I64 first = 0,
+      const I64 second = 0, const I64 third = 0, const I64 fourth = 0, const Size byteCount = 0);
+
+    /**
+     * @brief Clears the command stream, counts and byte counts. Object handles are not reused.
+     */
+    static void reset ();
+
+  public:
+    static inline void setStreamEnabled (bool enabled) { s_streamEnabled = enabled; }
+    static inline bool isStreamEnabled () { return s_streamEnabled; }
+    static inline const Collection<Command>& getCommands () { return s_commands; }
+    static inline Count getCallCount (const CommandType type)
+      { return s_callCounts[static_cast<Index>(type)]; }
+    static inline Size getByteCount (const CommandType type)
+      { return s_byteCounts[static_cast<Index>(type)]; }
+    static inline Size getTotalByteCount () { return s_totalByteCount; }
+
+  private:
+    static Collection<Command> s_commands;
+    static Count s_callCounts[COMMAND_TYPE_COUNT];
+    static Size s_byteCounts[COMMAND_TYPE_COUNT];
+    static Size s_totalByteCount;
+    static U32 s_nextHandle;
+    static bool s_streamEnabled;
+
+  };
+
+}
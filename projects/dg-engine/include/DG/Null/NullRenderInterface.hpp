@@ -0,0 +1,41 @@
+/** @file DG/Null/NullRenderInterface.hpp */
+
+#pragma once
+
+#if !defined(DG_USING_NULL_GRAPHICS)
+  #error "Do not #include this file if you are not using the null graphics backend!"
+#endif
+
+#include <DG/Graphics/RenderInterface.hpp>
+
+namespace dg::Null
+{
+
+  class RenderInterfaceImpl : public RenderInterface
+  {
+  public:
+
+    /**
+     * @brief The number of texture units reported by the null backend; a typical desktop value.
+     */
+    static constexpr Count TEXTURE_UNIT_COUNT = 32;
+
+  public:
+    RenderInterfaceImpl ();
+    ~RenderInterfaceImpl ();
+
+    void clear () override;
+    void setClearColor (const Vector4f& color) override;
+    void setViewport (I32 x, I32 y, I32 width, I32 height) override;
+    void setViewport (I32 width, I32 height) override;
+    void drawIndexed (const Shared<VertexArray>& vao, Count indexCount = 0,
+      Count baseVertex = 0) override;
+    void drawIndexedInstanced (const Shared<VertexArray>& vao, Count indexCount,
+      Count instanceCount, Count baseInstance = 0) override;
+    void multiDrawIndexedIndirect (const Shared<VertexArray>& vao,
+      const Shared<IndirectBuffer>& commands, Count drawCount, Index firstCommand = 0) override;
+    Count getTextureUnitCount () const override;
+
+  };
+
+}
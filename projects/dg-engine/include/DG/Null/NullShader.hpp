@@ -0,0 +1,110 @@
+/** @file DG/Null/NullShader.hpp */
+
+#pragma once
+
+#if !defined(DG_USING_NULL_GRAPHICS)
+  #error "Do not #include this file if you are not using the null graphics backend!"
+#endif
+
+#include <DG/Graphics/Shader.hpp>
+
+namespace dg::Null
+{
+
+  class ShaderImpl : public Shader
+  {
+  public:
+    ShaderImpl (const Path& path, const ShaderDefines& defines = {});
+    ShaderImpl (const String& vertexCode, const String& fragmentCode);
+    ~ShaderImpl ();
+
+  public:
+    void bind () const override;
+    void unbind () const override;
+    bool poll () override;
+    void wait () override;
+
+  public:
+    UniformHandle findUniform (const String& name) const override;
+
+  public:
+    bool setInteger (const String& key, I32 value) override;
+    bool setUnsignedInteger (const String& key, U32 value) override;
+    bool setFloat (const String& key, F32 value) override;
+    bool setDouble (const String& key, F64 value) override;
+    bool setBoolean (const String& key, bool value) override;
+
+    bool setVector2i (const String& key, const Vector2i& value) override;
+    bool setVector2u (const String& key, const Vector2u& value) override;
+    bool setVector2f (const String& key, const Vector2f& value) override;
+    bool setVector2d (const String& key, const Vector2d& value) override;
+    bool setVector2b (const String& key, const Vector2b& value) override;
+
+    bool setVector3i (const String& key, const Vector3i& value) override;
+    bool setVector3u (const String& key, const Vector3u& value) override;
+    bool setVector3f (const String& key, const Vector3f& value) override;
+    bool setVector3d (const String& key, const Vector3d& value) override;
+    bool setVector3b (const String& key, const Vector3b& value) override;
+
+    bool setVector4i (const String& key, const Vector4i& value) override;
+    bool setVector4u (const String& key, const Vector4u& value) override;
+    bool setVector4f (const String& key, const Vector4f& value) override;
+    bool setVector4d (const String& key, const Vector4d& value) override;
+    bool setVector4b (const String& key, const Vector4b& value) override;
+
+    bool setMatrix2f (const String& key, const Matrix2f& value) override;
+    bool setMatrix3f (const String& key, const Matrix3f& value) override;
+    bool setMatrix4f (const String& key, const Matrix4f& value) override;
+
+    bool setMatrix2d (const String& key, const Matrix2d& value) override;
+    bool setMatrix3d (const String& key, const Matrix3d& value) override;
+    bool setMatrix4d (const String& key, const Matrix4d& value) override;
+
+  public:
+    bool setInteger (UniformHandle uniform, I32 value) override;
+    bool setUnsignedInteger (UniformHandle uniform, U32 value) override;
+    bool setFloat (UniformHandle uniform, F32 value) override;
+    bool setDouble (UniformHandle uniform, F64 value) override;
+    bool setBoolean (UniformHandle uniform, bool value) override;
+
+    bool setVector2i (UniformHandle uniform, const Vector2i& value) override;
+    bool setVector2u (UniformHandle uniform, const Vector2u& value) override;
+    bool setVector2f (UniformHandle uniform, const Vector2f& value) override;
+    bool setVector2d (UniformHandle uniform, const Vector2d& value) override;
+    bool setVector2b (UniformHandle uniform, const Vector2b& value) override;
+
+    bool setVector3i (UniformHandle uniform, const Vector3i& value) override;
+    bool setVector3u (UniformHandle uniform, const Vector3u& value) override;
+    bool setVector3f (UniformHandle uniform, const Vector3f& value) override;
+    bool setVector3d (UniformHandle uniform, const Vector3d& value) override;
+    bool setVector3b (UniformHandle uniform, const Vector3b& value) override;
+
+    bool setVector4i (UniformHandle uniform, const Vector4i& value) override;
+    bool setVector4u (UniformHandle uniform, const Vector4u& value) override;
+    bool setVector4f (UniformHandle uniform, const Vector4f& value) override;
+    bool setVector4d (UniformHandle uniform, const Vector4d& value) override;
+    bool setVector4b (UniformHandle uniform, const Vector4b& value) override;
+
+    bool setMatrix2f (UniformHandle uniform, const Matrix2f& value) override;
+    bool setMatrix3f (UniformHandle uniform, const Matrix3f& value) override;
+    bool setMatrix4f (UniformHandle uniform, const Matrix4f& value) override;
+
+    bool setMatrix2d (UniformHandle uniform, const Matrix2d& value) override;
+    bool setMatrix3d (UniformHandle uniform, const Matrix3d& value) override;
+    bool setMatrix4d (UniformHandle uniform, const Matrix4d& value) override;
+
+    bool setIntegerArray (UniformHandle uniform, const I32* values, const Count count) override;
+
+  public:
+    inline U32 getHandle () const { return m_handle; }
+
+  private:
+    bool setUniform (UniformHandle uniform, const Size size);
+
+  private:
+    U32 m_handle = 0;
+    mutable Map<String, I32> m_uniforms;
+
+  };
+
+}
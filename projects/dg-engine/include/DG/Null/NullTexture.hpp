@@ -0,0 +1,73 @@
+/** @file DG/Null/NullTexture.hpp */
+
+#pragma once
+
+#if !defined(DG_USING_NULL_GRAPHICS)
+  #error "Do not #include this file if you are not using the null graphics backend!"
+#endif
+
+#include <DG/Graphics/Texture.hpp>
+
+namespace dg::Null
+{
+
+  class TextureImpl : public Texture
+  {
+  public:
+    TextureImpl (const Path& path);
+    TextureImpl (const TextureSpecification& spec);
+    ~TextureImpl () = default;
+
+  public:
+    void bind (const Index slot = 0) const override;
+    void unbind (const Index slot = 0) const override;
+    void upload (const void* data, const Size size) override;
+    void uploadRegion (const Vector2i& offset, const Vector2i& size, const void* data,
+      const Size dataSize) override;
+    void uploadRegion (const Vector2i& offset, const Vector2i& size,
+      const PixelUploadBuffer& buffer, const Size bufferOffset) override;
+    void swapStorage (Texture& other) override;
+    void* getPointer () const override;
+
+  public:
+    inline U32 getHandle () const { return m_handle; }
+
+  private:
+    bool initializeTexture () override;
+    bool onImageDataLoaded (const void* data) override;
+
+  private:
+    U32 m_handle = 0;
+
+  };
+
+  class TextureArrayImpl : public TextureArray
+  {
+  public:
+
+    /**
+     * @brief The most layers a texture array may have. This is the least maximum which an OpenGL
+     *        4.6 implementation may report.
+     */
+    static constexpr U32 MAX_LAYER_COUNT = 2048;
+
+  public:
+    TextureArrayImpl (const TextureArraySpecification& spec);
+    ~TextureArrayImpl () = default;
+
+  public:
+    void bind (const Index slot = 0) const override;
+    void unbind (const Index slot = 0) const override;
+    void uploadLayer (const U32 layer, const void* data, const Size size) override;
+    void copyLayer (const U32 layer, const Texture& texture) override;
+    void reserve (const U32 layerCount) override;
+
+  public:
+    inline U32 getHandle () const { return m_handle; }
+
+  private:
+    U32 m_handle = 0;
+
+  };
+
+}
@@ -0,0 +1,34 @@
+/** @file DG/Null/NullVertexArray.hpp */
+
+#pragma once
+
+#if !defined(DG_USING_NULL_GRAPHICS)
+  #error "Do not #include this file if you are not using the null graphics backend!"
+#endif
+
+#include <DG/Graphics/VertexArray.hpp>
+
+namespace dg::Null
+{
+
+  class VertexArrayImpl : public VertexArray
+  {
+  public:
+    VertexArrayImpl ();
+    ~VertexArrayImpl () = default;
+
+  public:
+    void bind () const override;
+    void unbind () const override;
+    void addVertexBuffer (const Shared<VertexBuffer>& vbo) override;
+    void setIndexBuffer (const Shared<IndexBuffer>& ibo) override;
+
+  public:
+    inline U32 getHandle () const { return m_handle; }
+
+  private:
+    U32 m_handle = 0;
+
+  };
+
+}
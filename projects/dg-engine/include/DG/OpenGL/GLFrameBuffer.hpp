@@ -17,6 +17,14 @@ namespace dg::OpenGL
     FrameBufferImpl (const FrameBufferSpecification& spec);
     ~FrameBufferImpl ();
 
+  public:
+
+    /**
+     * @brief Deletes every attachment texture released into the pool shared by all framebuffers.
+     *        This is done when the render interface is destroyed.
+     */
+    static void clearAttachmentPool ();
+
   public:
     void bind (FrameBufferBindTarget target = FrameBufferBindTarget::DRAW) const override;
     void unbind (FrameBufferBindTarget target = FrameBufferBindTarget::DRAW) const override;
@@ -25,15 +33,38 @@ namespace dg::OpenGL
     void* getColorPointer (const Index index = 0) const override;
     I32 readPixelI32 (const Index index, const Vector2i& position) const override;
     I32 readPixelI32 (const Index index, const Vector2f& position) const override;
+    bool pollReadbacks (const bool wait = false) override;
 
   private:
-    void onSizeChanged () override;
+    void onAllocatedSizeChanged () override;
+    void beginReadback (const Shared<FrameBufferReadback>& readback) override;
+    void releaseAttachments ();
     void build ();
 
   private:
     U32 m_handle = 0;
     Collection<U32> m_colorHandles;
     U32 m_depthHandle = 0;
+    Vector2u m_builtSize;
+    mutable I32 m_previousViewport[4] = { 0, 0, 0, 0 };
+    mutable bool m_viewportSaved = false;
+
+  private:
+
+    /**
+     * @brief A readback whose region is being copied into a pixel buffer object. The fence is
+     *        signaled once the copy is done, so that the buffer can be read without stalling.
+     */
+    struct PendingReadback
+    {
+      Shared<FrameBufferReadback> readback = nullptr;
+      U32 buffer = 0;
+      Size bufferSize = 0;
+      GLsync fence = nullptr;
+    };
+
+    std::deque<PendingReadback> m_readbacks;
+    Collection<PendingReadback> m_freeReadbackBuffers;
 
   };
 
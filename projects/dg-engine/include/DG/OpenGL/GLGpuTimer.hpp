@@ -0,0 +1,47 @@
+/** @file DG/OpenGL/GLGpuTimer.hpp */
+
+#pragma once
+
+#if !defined(DG_USING_OPENGL)
+  #error "Do not #include this file if you are not using OpenGL!"
+#endif
+
+#include <DG/Graphics/GpuTimer.hpp>
+
+namespace dg::OpenGL
+{
+
+  struct GpuTimerFrame
+  {
+    U32 beginQuery = 0;
+    U32 endQuery = 0;
+    Collection<U32> rangeQueries;
+    Count rangeCount = 0;
+    bool pending = false;
+  };
+
+  class GpuTimerImpl : public GpuTimer
+  {
+  public:
+    GpuTimerImpl (const Count latency);
+    ~GpuTimerImpl ();
+
+  public:
+    void beginFrame () override;
+    void endFrame () override;
+    void beginRange () override;
+    void endRange () override;
+    Count getLatency () const override;
+
+  private:
+    void readFrame (GpuTimerFrame& frame);
+
+  private:
+    Collection<GpuTimerFrame> m_frames;
+    Index m_current = 0;
+    bool m_frameStarted = false;
+    bool m_rangeStarted = false;
+
+  };
+
+}
@@ -22,12 +22,34 @@ namespace dg::OpenGL
     void bind () const override;
     void unbind () const override;
     void upload (const void* data, const Size size) override;
+    void uploadRange (const void* data, const Size size, const Size offset) override;
 
   private:
     U32 m_handle = 0;
 
   };
 
+  class StreamingVertexBufferImpl : public StreamingVertexBuffer
+  {
+  public:
+    StreamingVertexBufferImpl (const Size regionSize, const Count regionCount);
+    ~StreamingVertexBufferImpl ();
+
+  public:
+    void bind () const override;
+    void unbind () const override;
+    void upload (const void* data, const Size size) override;
+    void uploadRange (const void* data, const Size size, const Size offset) override;
+    void* acquireRegion () override;
+    void releaseRegion () override;
+
+  private:
+    U32 m_handle = 0;
+    U8* m_mapping = nullptr;
+    Collection<GLsync> m_fences;
+
+  };
+
   class IndexBufferImpl : public IndexBuffer
   {
   public:
@@ -44,4 +66,112 @@ namespace dg::OpenGL
 
   };
 
+  class IndirectBufferImpl : public IndirectBuffer
+  {
+  public:
+    IndirectBufferImpl (const Count commandCount);
+    ~IndirectBufferImpl ();
+
+  public:
+    void bind () const override;
+    void unbind () const override;
+    void upload (const DrawIndexedIndirectCommand* commands, const Count count) override;
+
+  private:
+    U32 m_handle = 0;
+
+  };
+
+  class StreamingIndirectBufferImpl : public StreamingIndirectBuffer
+  {
+  public:
+    StreamingIndirectBufferImpl (const Count regionCommandCount, const Count regionCount);
+    ~StreamingIndirectBufferImpl ();
+
+  public:
+    void bind () const override;
+    void unbind () const override;
+    void upload (const DrawIndexedIndirectCommand* commands, const Count count) override;
+    DrawIndexedIndirectCommand* acquireRegion () override;
+    void releaseRegion () override;
+
+  private:
+    U32 m_handle = 0;
+    DrawIndexedIndirectCommand* m_mapping = nullptr;
+    Collection<GLsync> m_fences;
+
+  };
+
+  class StorageBufferImpl : public StorageBuffer
+  {
+  public:
+    StorageBufferImpl (const Size size);
+    ~StorageBufferImpl ();
+
+  public:
+    void bind (const Index binding) const override;
+    void unbind (const Index binding) const override;
+    void upload (const void* data, const Size size) override;
+
+  private:
+    U32 m_handle = 0;
+
+  };
+
+  class StreamingStorageBufferImpl : public StreamingStorageBuffer
+  {
+  public:
+    StreamingStorageBufferImpl (const Size regionSize, const Count regionCount);
+    ~StreamingStorageBufferImpl ();
+
+  public:
+    void bind (const Index binding) const override;
+    void unbind (const Index binding) const override;
+    void upload (const void* data, const Size size) override;
+    void* acquireRegion () override;
+    void releaseRegion () override;
+
+  private:
+    U32 m_handle = 0;
+    U8* m_mapping = nullptr;
+    Collection<GLsync> m_fences;
+
+  };
+
+  class UniformBufferImpl : public UniformBuffer
+  {
+  public:
+    UniformBufferImpl (const Size size);
+    ~UniformBufferImpl ();
+
+  public:
+    void bind (const Index binding) const override;
+    void unbind (const Index binding) const override;
+    void upload (const void* data, const Size size) override;
+
+  private:
+    U32 m_handle = 0;
+
+  };
+
+  class PixelUploadBufferImpl : public PixelUploadBuffer
+  {
+  public:
+    PixelUploadBufferImpl (const Size regionSize, const Count regionCount);
+    ~PixelUploadBufferImpl ();
+
+  public:
+    void* acquireRegion () override;
+    void releaseRegion () override;
+
+  public:
+    inline U32 getHandle () const { return m_handle; }
+
+  private:
+    U32 m_handle = 0;
+    U8* m_mapping = nullptr;
+    Collection<GLsync> m_fences;
+
+  };
+
 }
@@ -21,7 +21,13 @@ namespace dg::OpenGL
     void setClearColor (const Vector4f& color) override;
     void setViewport (I32 x, I32 y, I32 width, I32 height) override;
     void setViewport (I32 width, I32 height) override;
-    void drawIndexed (const Shared<VertexArray>& vao, Count indexCount = 0) override;
+    void drawIndexed (const Shared<VertexArray>& vao, Count indexCount = 0,
+      Count baseVertex = 0) override;
+    void drawIndexedInstanced (const Shared<VertexArray>& vao, Count indexCount,
+      Count instanceCount, Count baseInstance = 0) override;
+    void multiDrawIndexedIndirect (const Shared<VertexArray>& vao,
+      const Shared<IndirectBuffer>& commands, Count drawCount, Index firstCommand = 0) override;
+    Count getTextureUnitCount () const override;
 
   };
 
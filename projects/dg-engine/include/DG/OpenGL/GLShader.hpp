@@ -11,16 +11,33 @@
 namespace dg::OpenGL
 {
 
+  /**
+   * @brief The @a `ProgramBinaryHeader` struct begins each file in the shader program cache,
+   *        followed by the program binary itself.
+   */
+  struct ProgramBinaryHeader
+  {
+    static constexpr U32 MAGIC = 0x42504744; // "DGPB"
+
+    U32 magic = MAGIC;
+    U32 format = 0;
+  };
+
   class ShaderImpl : public Shader
   {
   public:
-    ShaderImpl (const Path& path);
-    ShaderImpl (const String& vertexCode, const String& fragmentCode);
+    ShaderImpl (const Path& path, const ShaderDefines& defines = {}, bool async = false);
+    ShaderImpl (const String& vertexCode, const String& fragmentCode, bool async = false);
     ~ShaderImpl ();
 
   public:
     void bind () const override;
     void unbind () const override;
+    bool poll () override;
+    void wait () override;
+
+  public:
+    UniformHandle findUniform (const String& name) const override;
 
   public:
     bool setInteger (const String& key, I32 value) override;
@@ -55,14 +72,63 @@ namespace dg::OpenGL
     bool setMatrix3d (const String& key, const Matrix3d& value) override;
     bool setMatrix4d (const String& key, const Matrix4d& value) override;
 
+  public:
+    bool setInteger (UniformHandle uniform, I32 value) override;
+    bool setUnsignedInteger (UniformHandle uniform, U32 value) override;
+    bool setFloat (UniformHandle uniform, F32 value) override;
+    bool setDouble (UniformHandle uniform, F64 value) override;
+    bool setBoolean (UniformHandle uniform, bool value) override;
+
+    bool setVector2i (UniformHandle uniform, const Vector2i& value) override;
+    bool setVector2u (UniformHandle uniform, const Vector2u& value) override;
+    bool setVector2f (UniformHandle uniform, const Vector2f& value) override;
+    bool setVector2d (UniformHandle uniform, const Vector2d& value) override;
+    bool setVector2b (UniformHandle uniform, const Vector2b& value) override;
+
+    bool setVector3i (UniformHandle uniform, const Vector3i& value) override;
+    bool setVector3u (UniformHandle uniform, const Vector3u& value) override;
+    bool setVector3f (UniformHandle uniform, const Vector3f& value) override;
+    bool setVector3d (UniformHandle uniform, const Vector3d& value) override;
+    bool setVector3b (UniformHandle uniform, const Vector3b& value) override;
+
+    bool setVector4i (UniformHandle uniform, const Vector4i& value) override;
+    bool setVector4u (UniformHandle uniform, const Vector4u& value) override;
+    bool setVector4f (UniformHandle uniform, const Vector4f& value) override;
+    bool setVector4d (UniformHandle uniform, const Vector4d& value) override;
+    bool setVector4b (UniformHandle uniform, const Vector4b& value) override;
+
+    bool setMatrix2f (UniformHandle uniform, const Matrix2f& value) override;
+    bool setMatrix3f (UniformHandle uniform, const Matrix3f& value) override;
+    bool setMatrix4f (UniformHandle uniform, const Matrix4f& value) override;
+
+    bool setMatrix2d (UniformHandle uniform, const Matrix2d& value) override;
+    bool setMatrix3d (UniformHandle uniform, const Matrix3d& value) override;
+    bool setMatrix4d (UniformHandle uniform, const Matrix4d& value) override;
+
+    bool setIntegerArray (UniformHandle uniform, const I32* values, const Count count) override;
+
   private:
-    bool build ();
-    I32 findUniform (StringView key);
+    void startBuild (bool async);
+    bool beginBuild ();
+    bool finishBuild ();
+    Path getProgramCachePath () const;
+    bool loadProgramBinary (const Path& path);
+    void saveProgramBinary (const Path& path) const;
+    void reflectUniforms ();
+    bool checkUniform (UniformHandle uniform) const;
+    void logSourceFiles () const;
 
   private:
     U32 m_handle = 0;
+    U32 m_pendingProgram = 0;
+    U32 m_vertexShader = 0;
+    U32 m_fragmentShader = 0;
+    Map<String, I32> m_uniforms;
+    Path m_path = "";
+    Path m_cachePath = "";
     String m_vertexCode = "";
     String m_fragmentCode = "";
+    Collection<Path> m_sourceFiles;
 
   };
 
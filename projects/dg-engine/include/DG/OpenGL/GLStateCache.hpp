@@ -0,0 +1,103 @@
+/** @file DG/OpenGL/GLStateCache.hpp */
+
+#pragma once
+
+#if !defined(DG_USING_OPENGL)
+  #error "Do not #include this file if you are not using OpenGL!"
+#endif
+
+#include <DG/Math/Vector4.hpp>
+#include <DG/Graphics/Texture.hpp>
+
+namespace dg::OpenGL
+{
+
+  /**
+   * @brief The @a `StateCache` class shadows the OpenGL context state which the backend changes on
+   *        its hot paths, and skips every call which would not change it: the current program and
+   *        vertex array, the textures bound to each unit, the bound buffers, the bound framebuffers,
+   *        the viewport and the clear color.
+   *
+   * All binds and deletions of these objects within the backend must go through this class, so
+   * that its shadow state stays true. Code outside the backend which changes this state, such as
+   * the GUI renderer, must call @a `invalidate` afterwards, so that the next call of each kind is
+   * issued again. In debug builds, every skipped call is first checked against the state queried
+   * from the context, and any mismatch is logged and then corrected.
+   */
+  class StateCache
+  {
+  public:
+    static void useProgram (const U32 program);
+    static void bindVertexArray (const U32 vertexArray);
+
+    /**
+     * @brief Binds the given texture to the given target of the given texture unit, without
+     *        changing the active texture unit. The overload without a unit binds to the active
+     *        texture unit, which is all that is needed to create or upload to a texture.
+     */
+    static void bindTexture (const U32 target, const Index unit, const U32 texture);
+    static void bindTexture (const U32 target, const U32 texture);
+
+    static void bindBuffer (const U32 target, const U32 buffer);
+    static void bindBufferBase (const U32 target, const U32 index, const U32 buffer);
+    static void bindFrameBuffer (const U32 target, const U32 frameBuffer);
+    static void setViewport (const I32 x, const I32 y, const I32 width, const I32 height);
+    static void setClearColor (const Vector4f& color);
+
+    /**
+     * @brief Retrieves the current viewport as its x, y, width and height. This is only queried
+     *        from the context if the shadow viewport is not known.
+     */
+    static void getViewport (I32 (&viewport)[4]);
+
+  public:
+    static void deleteVertexArray (const U32 vertexArray);
+    static void deleteTexture (const U32 texture);
+    static void deleteBuffer (const U32 buffer);
+    static void deleteFrameBuffer (const U32 frameBuffer);
+
+  public:
+
+    /**
+     * @brief Forgets all of the shadow state, so that the next call of each kind is issued.
+     */
+    static void invalidate ();
+
+    static inline void setValidationEnabled (bool enabled) { s_validating = enabled; }
+    static inline bool isValidationEnabled () { return s_validating; }
+    static inline Count getSkippedCallCount () { return s_skippedCallCount; }
+
+  private:
+    static constexpr U32 UNKNOWN = 0xFFFFFFFF;
+    static constexpr Count TEXTURE_TARGET_COUNT = 3;
+    static constexpr Count BUFFER_TARGET_COUNT = 8;
+    static constexpr Count BUFFER_BINDING_COUNT = 16;
+
+    static bool validate (const Char* name, const U32 query, const U32 expected);
+    static bool validateIndexed (const Char* name, const U32 query, const U32 index,
+      const U32 expected);
+
+  private:
+    static inline U32 s_program = UNKNOWN;
+    static inline U32 s_vertexArray = UNKNOWN;
+    static inline U32 s_elementBuffer = UNKNOWN;
+    static inline U32 s_activeTextureUnit = UNKNOWN;
+    static inline U32 s_textures[TEXTURE_TARGET_COUNT][TEXTURE_UNIT_COUNT_MAX];
+    static inline U32 s_buffers[BUFFER_TARGET_COUNT];
+    static inline U32 s_uniformBuffers[BUFFER_BINDING_COUNT];
+    static inline U32 s_storageBuffers[BUFFER_BINDING_COUNT];
+    static inline U32 s_drawFrameBuffer = UNKNOWN;
+    static inline U32 s_readFrameBuffer = UNKNOWN;
+    static inline I32 s_viewport[4] = { -1, -1, -1, -1 };
+    static inline Vector4f s_clearColor = { -1.0f, -1.0f, -1.0f, -1.0f };
+    static inline Count s_skippedCallCount = 0;
+
+    #if defined(DG_DEBUG)
+      static inline bool s_validating = true;
+    #else
+      static inline bool s_validating = false;
+    #endif
+
+  };
+
+}
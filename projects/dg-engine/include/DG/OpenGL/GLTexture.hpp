@@ -22,8 +22,16 @@ namespace dg::OpenGL
     void bind (const Index slot = 0) const override;
     void unbind (const Index slot = 0) const override;
     void upload (const void* data, const Size size) override;
+    void uploadRegion (const Vector2i& offset, const Vector2i& size, const void* data,
+      const Size dataSize) override;
+    void uploadRegion (const Vector2i& offset, const Vector2i& size,
+      const PixelUploadBuffer& buffer, const Size bufferOffset) override;
+    void swapStorage (Texture& other) override;
     void* getPointer () const override;
 
+  public:
+    inline U32 getHandle () const { return m_handle; }
+
   private:
     bool initializeTexture () override;
     bool onImageDataLoaded (const void* data) override;
@@ -35,4 +43,27 @@ namespace dg::OpenGL
 
   };
 
+  class TextureArrayImpl : public TextureArray
+  {
+  public:
+    TextureArrayImpl (const TextureArraySpecification& spec);
+    ~TextureArrayImpl ();
+
+  public:
+    void bind (const Index slot = 0) const override;
+    void unbind (const Index slot = 0) const override;
+    void uploadLayer (const U32 layer, const void* data, const Size size) override;
+    void copyLayer (const U32 layer, const Texture& texture) override;
+    void reserve (const U32 layerCount) override;
+
+  private:
+    U32 allocate (const U32 layerCount);
+
+  private:
+    U32 m_handle = 0;
+    GLenum m_internalFormat = 0;
+    GLenum m_pixelFormat = 0;
+
+  };
+
 }
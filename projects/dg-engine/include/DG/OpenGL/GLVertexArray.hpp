@@ -25,6 +25,7 @@ namespace dg::OpenGL
 
   private:
     U32 m_handle = 0;
+    U32 m_attributeCount = 0;
 
   };
 
@@ -75,6 +75,23 @@ namespace dg
       return m_scene->m_registry.get<T>(m_handle);
     }
 
+    /**
+     * @brief Calls the given function on the component of type @a `T`, then notifies the scene
+     *        that the component has changed. In a scene with retained rendering enabled, changes
+     *        to an entity's transform or quad components must be made this way in order to reach
+     *        the renderer.
+     */
+    template <typename T, typename F>
+    inline T& patchComponent (F&& func)
+    {
+      if (hasComponents<T>() == false) {
+        DG_ENGINE_THROW(std::out_of_range, "Attempt to patch non-existant entity component '{}'!",
+          getPrettyTypename<T>());
+      }
+
+      return m_scene->m_registry.patch<T>(m_handle, std::forward<F>(func));
+    }
+
     template <typename T>
     inline void removeComponent ()
     {
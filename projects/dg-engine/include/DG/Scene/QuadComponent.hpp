@@ -3,7 +3,7 @@
 #pragma once
 
 #include <DG/Graphics/Color.hpp>
-#include <DG/Graphics/Texture.hpp>
+#include <DG/Graphics/TextureAtlas.hpp>
 
 namespace dg
 {
@@ -12,6 +12,14 @@ namespace dg
   {
     Vector4f color = Color::WHITE;
     Shared<Texture> texture = nullptr;
+    Vector4f texRect = { 0.0f, 0.0f, 1.0f, 1.0f };
+    U8 layer = 0;
+
+    inline void setSubTexture (const SubTexture& subTexture)
+    {
+      texture = subTexture.texture;
+      texRect = subTexture.texRect;
+    }
   };
 
 }
@@ -9,11 +9,20 @@ namespace dg
 {
 
   class Entity;
+  class Renderer;
 
   class Scene
   {
     friend class Entity;
 
+  public:
+
+    /**
+     * @brief The number of quads above which a scene records its quads on the application's
+     *        thread pool, rather than submitting them on the main thread.
+     */
+    static constexpr Count PARALLEL_QUAD_THRESHOLD = 4096;
+
   public:
     Scene ();
     ~Scene ();
@@ -25,11 +34,45 @@ namespace dg
     virtual void fixedUpdate (const F32 timestep);
     virtual void update ();
 
+  public:
+
+    /**
+     * @brief Enables or disables culling of quads which lie entirely outside the primary camera's
+     *        view. Culled quads are skipped before they reach the renderer.
+     */
+    inline void setCullingEnabled (bool enabled) { m_cullingEnabled = enabled; }
+    inline bool isCullingEnabled () const { return m_cullingEnabled; }
+    inline Count getVisibleQuadCount () const { return m_visibleQuadCount; }
+    inline Count getCulledQuadCount () const { return m_culledQuadCount; }
+
+    /**
+     * @brief Enables or disables retained rendering. With it enabled, the scene's quads are kept in
+     *        the renderer's retained quad buffer, and only quads whose transform or quad
+     *        components have been added, patched (see @a `Entity::patchComponent`) or removed
+     *        since the last update are re-sent to it. Retained quads are not culled.
+     */
+    void setRetainedRenderingEnabled (bool enabled);
+    inline bool isRetainedRenderingEnabled () const { return m_retainedEnabled; }
+
   private:
     void findPrimaryCameraMatrix (Matrix4f& cameraProduct);
+    void submitQuads (Renderer& renderer, const Matrix4f& cameraProduct);
+    void syncRetainedQuads (Renderer& renderer);
+    void releaseRetainedQuads ();
+    void onQuadDestroyed (entt::registry& registry, entt::entity entity);
 
   private:
     entt::registry m_registry;
+    Collection<entt::entity> m_quadEntities;
+    bool m_cullingEnabled = true;
+    Count m_visibleQuadCount = 0;
+    Count m_culledQuadCount = 0;
+    entt::observer m_quadObserver;
+    Map<entt::entity, Index> m_retainedQuads;
+    Collection<Index> m_removedRetainedQuads;
+    U32 m_retainedGeneration = 0;
+    bool m_retainedEnabled = false;
+    bool m_retainedResync = true;
 
   };
 
@@ -27,10 +27,17 @@ namespace dg
     }
 
     Logging::initialize();
+    Shader::setProgramCacheDirectory(spec.shaderCacheDirectory);
     m_eventBus    = EventBus::make(*this);
     m_window      = Window::make(spec.windowSpec);
     m_renderer    = Renderer::make();
     m_layerStack  = std::make_unique<LayerStack>();
+    m_threadPool  = ThreadPool::make(spec.workerThreadCount);
+    m_textureLoader = TextureLoader::make(*m_threadPool, {
+      .uploadBudget = spec.textureUploadBudget
+    });
+    m_assetCache = AssetCache::make({ .memoryBudget = spec.assetMemoryBudget },
+      m_textureLoader.get());
     Input::initialize();
 
     if (spec.guiSpec.enabled == true) {
@@ -43,6 +50,9 @@ namespace dg
     Gui::shutdown();
     Input::shutdown();
     m_layerStack.reset();
+    m_assetCache.reset();
+    m_textureLoader.reset();
+    m_threadPool.reset();
     m_renderer.reset();
     m_window.reset();
     m_eventBus.reset();
@@ -81,6 +91,24 @@ namespace dg
     return *s_instance->m_layerStack;
   }
 
+  ThreadPool& Application::getThreadPool ()
+  {
+    assert(s_instance != nullptr);
+    return *s_instance->m_threadPool;
+  }
+
+  TextureLoader& Application::getTextureLoader ()
+  {
+    assert(s_instance != nullptr);
+    return *s_instance->m_textureLoader;
+  }
+
+  AssetCache& Application::getAssetCache ()
+  {
+    assert(s_instance != nullptr);
+    return *s_instance->m_assetCache;
+  }
+
   /** Start Application Loop **************************************************/
 
   void Application::start ()
@@ -100,7 +128,7 @@ namespace dg
         fixedUpdate();
       }
 
-      update();
+      update(elapsedTime);
     }
   }
 
@@ -129,8 +157,15 @@ namespace dg
     }
   }
 
-  void Application::update ()
+  void Application::update (const F32 elapsedTime)
   {
+    Shader::pollPending();
+    FrameBuffer::pollPendingReadbacks();
+    m_textureLoader->update();
+
+    const Vector2u& windowSize = m_window->getSize();
+    m_renderer->beginFrame(elapsedTime, { static_cast<F32>(windowSize.x),
+      static_cast<F32>(windowSize.y) });
     RenderCommand::clear();
 
     for (auto layer : *m_layerStack) {
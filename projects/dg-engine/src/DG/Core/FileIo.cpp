@@ -76,4 +76,37 @@ namespace dg
     return true;
   }
 
-}
\ No newline at end of file
+  bool FileIo::saveBinaryFile (const Path& path, const void* data, const Size size)
+  {
+    if (path.empty()) {
+      DG_ENGINE_ERROR("No binary filename specified for saving.");
+      return false;
+    }
+
+    std::error_code error;
+    if (path.has_parent_path() == true) {
+      fs::create_directories(path.parent_path(), error);
+      if (error) {
+        DG_ENGINE_ERROR("Could not create directory '{}' - {}", path.parent_path(),
+          error.message());
+        return false;
+      }
+    }
+
+    std::fstream file { path, std::ios::out | std::ios::binary | std::ios::trunc };
+    if (file.is_open() == false) {
+      DG_ENGINE_ERROR("Could not open binary file '{}' for writing.", path);
+      return false;
+    }
+
+    file.write(static_cast<const char*>(data), size);
+    if (file.good() == false) {
+      DG_ENGINE_ERROR("Could not write {} bytes to binary file '{}'.", size, path);
+      return false;
+    }
+
+    file.close();
+    return true;
+  }
+
+}
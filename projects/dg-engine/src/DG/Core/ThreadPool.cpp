@@ -0,0 +1,134 @@
+/** @file DG/Core/ThreadPool.cpp */
+
+#include <DG/Core/ThreadPool.hpp>
+
+namespace dg
+{
+
+  ThreadPool::ThreadPool (const Count threadCount)
+  {
+    Count count = threadCount;
+    if (count == 0) {
+      Count hardwareCount = std::thread::hardware_concurrency();
+      count = (hardwareCount > 1) ? hardwareCount - 1 : 1;
+    }
+
+    m_threads.reserve(count);
+    for (Index i = 0; i < count; ++i) {
+      m_threads.emplace_back([this] { work(); });
+    }
+  }
+
+  ThreadPool::~ThreadPool ()
+  {
+    {
+      std::lock_guard lock { m_mutex };
+      m_stopping = true;
+    }
+
+    m_taskCondition.notify_all();
+    for (auto& thread : m_threads) {
+      thread.join();
+    }
+  }
+
+  Unique<ThreadPool> ThreadPool::make (const Count threadCount)
+  {
+    return std::make_unique<ThreadPool>(threadCount);
+  }
+
+  void ThreadPool::submit (Task task)
+  {
+    {
+      std::lock_guard lock { m_mutex };
+      m_tasks.push_back(std::move(task));
+    }
+
+    m_taskCondition.notify_one();
+  }
+
+  void ThreadPool::wait ()
+  {
+    std::unique_lock lock { m_mutex };
+    m_idleCondition.wait(lock, [this] { return m_tasks.empty() && m_busyCount == 0; });
+  }
+
+  void ThreadPool::parallelFor (const Count count, const RangeTask& task, Count chunkCount)
+  {
+    if (count == 0) { return; }
+    if (chunkCount == 0) { chunkCount = m_threads.size() + 1; }
+    if (chunkCount > count) { chunkCount = count; }
+
+    // The chunks report back through state local to this call, so that waiting on them does not
+    // also wait on unrelated tasks queued to the pool.
+    struct
+    {
+      std::mutex mutex;
+      std::condition_variable condition;
+      Count remaining;
+      std::exception_ptr exception;
+    } state;
+    state.remaining = chunkCount - 1;
+
+    auto runChunk = [&] (Index chunk) {
+      Index begin = count * chunk / chunkCount;
+      Index end = count * (chunk + 1) / chunkCount;
+
+      try {
+        task(begin, end, chunk);
+      } catch (...) {
+        std::lock_guard lock { state.mutex };
+        if (state.exception == nullptr) { state.exception = std::current_exception(); }
+      }
+    };
+
+    for (Index chunk = 1; chunk < chunkCount; ++chunk) {
+      submit([&, chunk] {
+        runChunk(chunk);
+
+        std::lock_guard lock { state.mutex };
+        if (--state.remaining == 0) { state.condition.notify_one(); }
+      });
+    }
+
+    runChunk(0);
+
+    std::unique_lock lock { state.mutex };
+    state.condition.wait(lock, [&] { return state.remaining == 0; });
+    if (state.exception != nullptr) {
+      std::rethrow_exception(state.exception);
+    }
+  }
+
+  void ThreadPool::work ()
+  {
+    while (true) {
+      Task task;
+
+      {
+        std::unique_lock lock { m_mutex };
+        m_taskCondition.wait(lock, [this] { return m_stopping || m_tasks.empty() == false; });
+        if (m_stopping == true && m_tasks.empty() == true) { return; }
+
+        task = std::move(m_tasks.front());
+        m_tasks.pop_front();
+        m_busyCount++;
+      }
+
+      try {
+        task();
+      } catch (const std::exception& ex) {
+        DG_ENGINE_ERROR("Uncaught exception in thread pool task - {}", ex.what());
+      } catch (...) {
+        DG_ENGINE_ERROR("Uncaught exception in thread pool task.");
+      }
+
+      {
+        std::lock_guard lock { m_mutex };
+        m_busyCount--;
+        if (m_tasks.empty() == true && m_busyCount == 0) { m_idleCondition.notify_all(); }
+      }
+    }
+  }
+
+}
@@ -11,6 +11,10 @@
 #include <DG/Core/Application.hpp>
 #include <DG/GLFW/GLFWGuiContext.hpp>
 
+#if defined(DG_USING_OPENGL)
+  #include <DG/OpenGL/GLStateCache.hpp>
+#endif
+
 namespace dg
 {
 
@@ -50,6 +54,14 @@ namespace dg::GLFW
         true
       );
       ImGui_ImplOpenGL3_Init("#version 450 core");
+    #else
+      ImGui_ImplGlfw_InitForOther(
+        reinterpret_cast<GLFWwindow*>(Application::getWindow().getPointer()),
+        true
+      );
+
+      // With no renderer backend to build the font atlas, it must be built here.
+      io.Fonts->Build();
     #endif
   }
 
@@ -88,6 +100,9 @@ namespace dg::GLFW
 
         glfwMakeContextCurrent(context);
       }
+
+      // The GUI renderer binds its own objects behind the state cache's back.
+      OpenGL::StateCache::invalidate();
     #endif
   }
 
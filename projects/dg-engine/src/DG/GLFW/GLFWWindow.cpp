@@ -115,6 +115,12 @@ namespace dg::GLFW
   {
     if (s_windowCount == 0) {
       glfwSetErrorCallback(onError);
+
+      // With no graphics card to draw to, no display is needed either.
+      #if defined(DG_USING_NULL_GRAPHICS)
+        glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+      #endif
+
       if (glfwInit() != GLFW_TRUE) {
         DG_ENGINE_THROW(std::runtime_error, "Could not initialize GLFW!");
       }
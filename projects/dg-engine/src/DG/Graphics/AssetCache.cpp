@@ -0,0 +1,130 @@
+/** @file DG/Graphics/AssetCache.cpp */
+
+#include <DG/Core/FileIo.hpp>
+#include <DG/Graphics/AssetCache.hpp>
+
+namespace dg
+{
+
+  static Size getTextureSize (const Texture& texture)
+  {
+    return static_cast<Size>(texture.getSize().x) * texture.getSize().y *
+      texture.getColorChannelCount();
+  }
+
+  AssetCache::AssetCache (const AssetCacheSpecification& spec, TextureLoader* textureLoader) :
+    m_textureLoader { textureLoader },
+    m_memoryBudget { spec.memoryBudget }
+  {
+
+  }
+
+  Unique<AssetCache> AssetCache::make (const AssetCacheSpecification& spec,
+    TextureLoader* textureLoader)
+  {
+    return std::make_unique<AssetCache>(spec, textureLoader);
+  }
+
+  Shared<Texture> AssetCache::getTexture (const Path& path, const bool async)
+  {
+    String key = FileIo::getAbsolute(path).string();
+    if (auto iter = m_textures.find(key); iter != m_textures.end()) {
+      m_stats.hitCount++;
+      iter->second.lastUsed = ++m_useCounter;
+      return iter->second.asset;
+    }
+
+    m_stats.missCount++;
+
+    Shared<Texture> texture = nullptr;
+    if (async == true && m_textureLoader != nullptr) {
+      texture = m_textureLoader->load(key);
+    } else {
+      texture = Texture::make(Path { key });
+    }
+
+    m_textures[key] = { texture, ++m_useCounter };
+    collect();
+    return texture;
+  }
+
+  Shared<Shader> AssetCache::getShader (const Path& path, const ShaderDefines& defines)
+  {
+    String key = ShaderPreprocessor::getPermutationKey(path, defines);
+    if (auto iter = m_shaders.find(key); iter != m_shaders.end()) {
+      m_stats.hitCount++;
+      iter->second.lastUsed = ++m_useCounter;
+      return iter->second.asset;
+    }
+
+    m_stats.missCount++;
+
+    Shared<Shader> shader = Shader::make(ShaderSpecification {
+      .path = FileIo::getAbsolute(path),
+      .defines = defines
+    });
+
+    m_shaders[key] = { shader, ++m_useCounter };
+    collect();
+    return shader;
+  }
+
+  void AssetCache::collect ()
+  {
+    Size residentSize = getResidentSize();
+    if (residentSize <= m_memoryBudget) { return; }
+
+    // Only textures count toward the budget, so only they are evicted to meet it. An entry's asset
+    // is unused outside of the cache when the cache holds its only reference.
+    Collection<Dictionary<Entry<Texture>>::iterator> candidates;
+    for (auto iter = m_textures.begin(); iter != m_textures.end(); ++iter) {
+      if (iter->second.asset.use_count() == 1) { candidates.push_back(iter); }
+    }
+
+    std::sort(candidates.begin(), candidates.end(), [] (const auto& lhs, const auto& rhs) {
+      return lhs->second.lastUsed < rhs->second.lastUsed;
+    });
+
+    for (const auto& iter : candidates) {
+      if (residentSize <= m_memoryBudget) { break; }
+
+      residentSize -= getTextureSize(*iter->second.asset);
+      m_textures.erase(iter);
+      m_stats.evictionCount++;
+    }
+  }
+
+  void AssetCache::purge ()
+  {
+    auto evictUnused = [this] (auto& entries) {
+      m_stats.evictionCount += std::erase_if(entries, [] (const auto& entry) {
+        return entry.second.asset.use_count() == 1;
+      });
+    };
+
+    evictUnused(m_textures);
+    evictUnused(m_shaders);
+  }
+
+  void AssetCache::setMemoryBudget (const Size memoryBudget)
+  {
+    m_memoryBudget = memoryBudget;
+    collect();
+  }
+
+  void AssetCache::resetStats ()
+  {
+    m_stats = {};
+  }
+
+  Size AssetCache::getResidentSize () const
+  {
+    Size residentSize = 0;
+    for (const auto& [key, entry] : m_textures) {
+      residentSize += getTextureSize(*entry.asset);
+    }
+
+    return residentSize;
+  }
+
+}
@@ -0,0 +1,189 @@
+/** @file DG/Graphics/FrameBuffer.cpp */
+
+#include <DG/Graphics/FrameBuffer.hpp>
+#include <DG/Math/MathUtils.hpp>
+
+namespace dg
+{
+
+  FrameBuffer::FrameBuffer (const FrameBufferSpecification& spec) :
+    m_spec { spec },
+    m_allocatedSize { getBucketedSize(spec.size) }
+  {
+    setRenderScale(spec.renderScale);
+  }
+
+  Vector2u FrameBuffer::getRenderSize () const
+  {
+    if (m_spec.renderScale >= 1.0f) { return m_spec.size; }
+
+    return {
+      std::max(static_cast<U32>(std::ceil(m_spec.size.x * m_spec.renderScale)), 1u),
+      std::max(static_cast<U32>(std::ceil(m_spec.size.y * m_spec.renderScale)), 1u)
+    };
+  }
+
+  void FrameBuffer::setRenderScale (const F32 renderScale)
+  {
+    m_spec.renderScale = clamp(renderScale, 0.01f, 1.0f);
+  }
+
+  bool FrameBuffer::setSize (const Vector2u& size)
+  {
+    if (size.x == 0 || size.y == 0) { return false; }
+
+    bool sizeChanged = (size != m_spec.size);
+    m_spec.size = size;
+
+    // Grow the attachments right away to fit the new size, but only shrink them once they have been
+    // too large for a while, so that a size which keeps changing, as while a window is being
+    // resized, does not rebuild them every time.
+    Vector2u neededSize = getBucketedSize(size);
+    Vector2u allocatedSize = neededSize;
+    if (m_spec.resizePolicy.bucketSize > 0) {
+      allocatedSize = {
+        std::max(m_allocatedSize.x, neededSize.x),
+        std::max(m_allocatedSize.y, neededSize.y)
+      };
+
+      if (allocatedSize == neededSize) {
+        m_shrinkCounter = 0;
+      } else if (++m_shrinkCounter >= m_spec.resizePolicy.shrinkDelay) {
+        allocatedSize = neededSize;
+        m_shrinkCounter = 0;
+      }
+    }
+
+    if (allocatedSize != m_allocatedSize) {
+      m_allocatedSize = allocatedSize;
+      onAllocatedSizeChanged();
+    }
+
+    return sizeChanged;
+  }
+
+  Shared<FrameBufferReadback> FrameBuffer::readPixelI32Async (const Index index,
+    const Vector2i& position, const FrameBufferReadback::Callback& callback)
+  {
+    if (
+      position.x < 0 || position.y < 0 ||
+      position.x >= static_cast<I32>(m_spec.size.x) || position.y >= static_cast<I32>(m_spec.size.y)
+    ) {
+      auto readback = std::make_shared<FrameBufferReadback>();
+      readback->attachmentIndex = index;
+      readback->offset = position;
+      readback->callback = callback;
+      readback->values.push_back(-1);
+      finishReadback(*readback);
+      return readback;
+    }
+
+    return readRegionI32Async(index, position, { 1, 1 }, callback);
+  }
+
+  Shared<FrameBufferReadback> FrameBuffer::readRegionI32Async (const Index index,
+    const Vector2i& offset, const Vector2i& size, const FrameBufferReadback::Callback& callback)
+  {
+    if (index >= m_colorAttachmentSpecs.size()) {
+      DG_ENGINE_THROW(std::out_of_range,
+        "Attempt to read pixel data from framebuffer color attachment at out of range index {}!",
+          index);
+    }
+
+    if (m_colorAttachmentSpecs.at(index).format != FrameBufferTextureFormat::COLOR_R32I) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to read integer pixel data from non-integer framebuffer color attachment {}!",
+          index);
+    }
+
+    Vector2i low = {
+      std::max(offset.x, 0),
+      std::max(offset.y, 0)
+    };
+    Vector2i high = {
+      std::min(offset.x + size.x, static_cast<I32>(m_spec.size.x)),
+      std::min(offset.y + size.y, static_cast<I32>(m_spec.size.y))
+    };
+
+    auto readback = std::make_shared<FrameBufferReadback>();
+    readback->attachmentIndex = index;
+    readback->callback = callback;
+
+    if (high.x <= low.x || high.y <= low.y) {
+      readback->offset = low;
+      finishReadback(*readback);
+      return readback;
+    }
+
+    // The region is given relative to the framebuffer's full size, but read from its drawn region,
+    // which is smaller at a reduced render scale.
+    low = getRenderPosition(low);
+    high = getRenderPosition(high - 1) + 1;
+    readback->offset = low;
+    readback->size = high - low;
+
+    listPendingReadbacks();
+    beginReadback(readback);
+    return readback;
+  }
+
+  void FrameBuffer::pollPendingReadbacks ()
+  {
+    // Readback callbacks may start new readbacks, which list their framebuffers again, so the list
+    // is taken out while it is polled, and those still pending are put back.
+    Collection<Weak<FrameBuffer>> polled;
+    std::swap(polled, s_pendingFrameBuffers);
+
+    for (const auto& pending : polled) {
+      Shared<FrameBuffer> frameBuffer = pending.lock();
+      if (frameBuffer != nullptr && frameBuffer->pollReadbacks() == false) {
+        frameBuffer->listPendingReadbacks();
+      }
+    }
+  }
+
+  void FrameBuffer::listPendingReadbacks ()
+  {
+    // Only framebuffers with readbacks pending are polled, so this one is listed if it is not yet.
+    bool listed = std::any_of(s_pendingFrameBuffers.begin(), s_pendingFrameBuffers.end(),
+      [this] (const Weak<FrameBuffer>& pending) { return pending.lock().get() == this; });
+    if (listed == false) {
+      s_pendingFrameBuffers.push_back(weak_from_this());
+    }
+  }
+
+  void FrameBuffer::finishReadback (FrameBufferReadback& readback)
+  {
+    std::sort(readback.values.begin(), readback.values.end());
+    readback.values.erase(std::unique(readback.values.begin(), readback.values.end()),
+      readback.values.end());
+    readback.ready = true;
+
+    if (readback.callback != nullptr) {
+      readback.callback(readback);
+    }
+  }
+
+  Vector2i FrameBuffer::getRenderPosition (const Vector2i& position) const
+  {
+    if (m_spec.renderScale >= 1.0f) { return position; }
+
+    Vector2u renderSize = getRenderSize();
+    return {
+      static_cast<I32>(static_cast<I64>(position.x) * renderSize.x / m_spec.size.x),
+      static_cast<I32>(static_cast<I64>(position.y) * renderSize.y / m_spec.size.y)
+    };
+  }
+
+  Vector2u FrameBuffer::getBucketedSize (const Vector2u& size) const
+  {
+    U32 bucketSize = m_spec.resizePolicy.bucketSize;
+    if (bucketSize == 0) { return size; }
+
+    return {
+      (size.x + bucketSize - 1) / bucketSize * bucketSize,
+      (size.y + bucketSize - 1) / bucketSize * bucketSize
+    };
+  }
+
+}
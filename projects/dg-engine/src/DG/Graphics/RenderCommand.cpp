@@ -37,9 +37,27 @@ namespace dg
     s_interface->setViewport(width, height);
   }
 
-  void RenderCommand::drawIndexed (const Shared<VertexArray>& vao, Count indexCount)
+  void RenderCommand::drawIndexed (const Shared<VertexArray>& vao, Count indexCount,
+    Count baseVertex)
   {
-    s_interface->drawIndexed(vao, indexCount);
+    s_interface->drawIndexed(vao, indexCount, baseVertex);
+  }
+
+  void RenderCommand::drawIndexedInstanced (const Shared<VertexArray>& vao, Count indexCount,
+    Count instanceCount, Count baseInstance)
+  {
+    s_interface->drawIndexedInstanced(vao, indexCount, instanceCount, baseInstance);
+  }
+
+  void RenderCommand::multiDrawIndexedIndirect (const Shared<VertexArray>& vao,
+    const Shared<IndirectBuffer>& commands, Count drawCount, Index firstCommand)
+  {
+    s_interface->multiDrawIndexedIndirect(vao, commands, drawCount, firstCommand);
+  }
+
+  Count RenderCommand::getTextureUnitCount ()
+  {
+    return s_interface->getTextureUnitCount();
   }
 
 }
@@ -1,16 +1,125 @@
 /** @file DG/Graphics/Renderer.cpp */
 
-#include <DG/Math/Transforms.hpp>
 #include <DG/Graphics/RenderCommand.hpp>
 #include <DG/Graphics/Renderer.hpp>
 
 namespace dg
 {
 
+  static QuadCommand2D makeQuadCommand2D (const Vector3f& axisX, const Vector3f& axisY,
+    const Vector3f& origin, const RenderSpecification2D& spec)
+  {
+    return {
+      axisX,
+      axisY,
+      origin,
+      Color::packRGBA8(spec.color),
+      spec.entityId,
+      {
+        packUnorm16(spec.texRect.x),
+        packUnorm16(spec.texRect.y),
+        packUnorm16(spec.texRect.z),
+        packUnorm16(spec.texRect.w)
+      },
+      spec.texture
+    };
+  }
+
+  static QuadCommand2D makeQuadCommand2D (const Matrix4f& transform,
+    const RenderSpecification2D& spec)
+  {
+    return makeQuadCommand2D(
+      { transform.aa, transform.ab, transform.ac },
+      { transform.ba, transform.bb, transform.bc },
+      { transform.da, transform.db, transform.dc },
+      spec
+    );
+  }
+
+  static QuadCommand2D makeQuadCommand2D (const QuadTransform2D& transform,
+    const RenderSpecification2D& spec)
+  {
+    return makeQuadCommand2D(
+      { transform.axisX.x, transform.axisX.y, 0.0f },
+      { transform.axisY.x, transform.axisY.y, 0.0f },
+      transform.origin,
+      spec
+    );
+  }
+
+  static U64 makeQuadSortKey2D (const QuadCommand2D& command, const U8 layer)
+  {
+    // Flip the depth's sign bit (or all of its bits, if negative) so that its bits sort as unsigned
+    // integers in the same order as the original floats. The texture's bits are a hash of its
+    // address; a collision only costs batching, since the command holds the texture itself. The
+    // shader slot's bits are left clear, to be filled in when the quad joins the scene.
+    U32 depth = 0;
+    std::memcpy(&depth, &command.origin.z, sizeof(U32));
+    depth = (depth & 0x80000000) ? ~depth : (depth | 0x80000000);
+
+    U64 textureBits = 0;
+    if (command.texture != nullptr) {
+      textureBits = (reinterpret_cast<std::uintptr_t>(command.texture.get()) *
+        0x9E3779B97F4A7C15ull) >> 48;
+    }
+
+    return
+      (static_cast<U64>(layer) << 56) |
+      (static_cast<U64>(depth) << 16) |
+      textureBits;
+  }
+
+  static void bindQuadSamplers2D (Shader& shader)
+  {
+    // Each element of a quad shader's sampler arrays samples from the texture unit of the same
+    // index. Both arrays are set through their first elements, and only one of them will exist.
+    static const std::array<I32, TEXTURE_UNIT_COUNT_MAX> units = [] {
+      std::array<I32, TEXTURE_UNIT_COUNT_MAX> units;
+      for (Index i = 0; i < units.size(); ++i) { units[i] = static_cast<I32>(i); }
+      return units;
+    }();
+
+    shader.setIntegerArray(shader.findUniform("uni_TexSlots"), units.data(), units.size());
+    shader.setIntegerArray(shader.findUniform("uni_TexArrays"), units.data(), units.size());
+  }
+
+  /** Quad Recorder *******************************************************************************/
+
+  void QuadRecorder2D::submitQuad2D (const Matrix4f& transform, const RenderSpecification2D& spec)
+  {
+    m_commands.push_back(makeQuadCommand2D(transform, spec));
+    m_keys.push_back(makeQuadSortKey2D(m_commands.back(), spec.layer));
+  }
+
+  void QuadRecorder2D::submitQuad2D (const QuadTransform2D& transform,
+    const RenderSpecification2D& spec)
+  {
+    m_commands.push_back(makeQuadCommand2D(transform, spec));
+    m_keys.push_back(makeQuadSortKey2D(m_commands.back(), spec.layer));
+  }
+
+  void QuadRecorder2D::submitQuad2D (const Vector3f& position, const Vector2f& size,
+    const F32 rotation, const RenderSpecification2D& spec)
+  {
+    submitQuad2D(QuadTransform2D::fromTRS(position, size, rotation), spec);
+  }
+
+  void QuadRecorder2D::clear ()
+  {
+    m_commands.clear();
+    m_keys.clear();
+  }
+
+  /** Renderer ************************************************************************************/
+
   Renderer::Renderer ()
   {
     RenderCommand::initialize();
     RenderData2D& rd = m_renderData2D;
+
+    // Frame Uniforms
+    m_frameUniformBuffer = UniformBuffer::allocate(sizeof(FrameUniforms));
+    uploadFrameUniforms();
     
     // Blank White Texture
     U32 blankTextureData = 0xFFFFFFFF;
@@ -32,29 +141,52 @@ namespace dg
       indices[i + 5] = o + 0;   
     }
     Shared<IndexBuffer> ibo = IndexBuffer::make(indices);
+    rd.quadIndexBuffer = ibo;
 
     // Quad Vertices
     rd.quadVertexArray = VertexArray::make();
-    rd.quadVertices.resize(RenderData2D::VERTICES_PER_BATCH + 20);
-    rd.quadVertexBuffer = VertexBuffer::allocateFrom<QuadVertex2D>(rd.quadVertices.size());
+    rd.quadVertexBuffer = StreamingVertexBuffer::make(
+      RenderData2D::VERTICES_PER_BATCH * sizeof(QuadVertex2D),
+      RenderData2D::STREAMING_REGION_COUNT
+    );
     rd.quadVertexBuffer->setLayout({
-      { "in_Position",  VertexAttributeType::Float3 },
-      { "in_TexCoords", VertexAttributeType::Float2 },
-      { "in_Color",     VertexAttributeType::Float4 },
-      { "in_TexIndex",  VertexAttributeType::Float  },
-      { "in_EntityId",  VertexAttributeType::Float  }
+      { "in_Position",  VertexAttributeType::Float3         },
+      { "in_TexCoords", VertexAttributeType::Ushort2, true  },
+      { "in_Color",     VertexAttributeType::Ubyte4,  true  },
+      { "in_TexIndex",  VertexAttributeType::Int            },
+      { "in_EntityId",  VertexAttributeType::Int            }
     });
     rd.quadVertexArray->addVertexBuffer(rd.quadVertexBuffer);
     rd.quadVertexArray->setIndexBuffer(ibo);
-    rd.quadVertexPositions[0] = { -0.5f, -0.5f, 0.0f, 1.0f };
-    rd.quadVertexPositions[1] = {  0.5f, -0.5f, 0.0f, 1.0f };
-    rd.quadVertexPositions[2] = {  0.5f,  0.5f, 0.0f, 1.0f };
-    rd.quadVertexPositions[3] = { -0.5f,  0.5f, 0.0f, 1.0f };
-    rd.quadTexCoords[0] = { 0.0f, 0.0f };
-    rd.quadTexCoords[1] = { 1.0f, 0.0f };
-    rd.quadTexCoords[2] = { 1.0f, 1.0f };
-    rd.quadTexCoords[3] = { 0.0f, 1.0f };
-    
+
+    // Quad Instances
+    Collection<QuadCorner2D> corners = {
+      { { -0.5f, -0.5f }, { 0.0f, 0.0f } },
+      { {  0.5f, -0.5f }, { 1.0f, 0.0f } },
+      { {  0.5f,  0.5f }, { 1.0f, 1.0f } },
+      { { -0.5f,  0.5f }, { 0.0f, 1.0f } }
+    };
+    rd.quadInstanceArray = VertexArray::make();
+    rd.quadCornerBuffer = VertexBuffer::makeFrom(corners);
+    rd.quadCornerBuffer->setLayout({
+      { "in_Corner",      VertexAttributeType::Float2 },
+      { "in_TexCoords",   VertexAttributeType::Float2 }
+    });
+    rd.quadInstanceBuffer = StreamingVertexBuffer::make(
+      RenderData2D::QUADS_PER_BATCH * sizeof(QuadInstance2D),
+      RenderData2D::STREAMING_REGION_COUNT
+    );
+    rd.quadInstanceBuffer->setLayout({
+      { "in_Basis",       VertexAttributeType::Float4, false, 1 },
+      { "in_Translation", VertexAttributeType::Float3, false, 1 },
+      { "in_Color",       VertexAttributeType::Ubyte4, true,  1 },
+      { "in_TexIndex",    VertexAttributeType::Int,    false, 1 },
+      { "in_EntityId",    VertexAttributeType::Int,    false, 1 },
+      { "in_TexRect",     VertexAttributeType::Ushort4, true, 1 }
+    });
+    rd.quadInstanceArray->addVertexBuffer(rd.quadCornerBuffer);
+    rd.quadInstanceArray->addVertexBuffer(rd.quadInstanceBuffer);
+    rd.quadInstanceArray->setIndexBuffer(ibo);
   }
 
   Renderer::~Renderer ()
@@ -62,10 +194,32 @@ namespace dg
     RenderCommand::shutdown();
     RenderData2D& rd = m_renderData2D;
     
+    rd.quadVertices = nullptr;
+    rd.quadInstances = nullptr;
     rd.quadVertexArray.reset();
     rd.quadVertexBuffer.reset();
+    rd.quadInstanceArray.reset();
+    rd.quadCornerBuffer.reset();
+    rd.quadInstanceBuffer.reset();
     rd.blankTexture.reset();
+    rd.arrayEntries.clear();
+    rd.arrayPages.clear();
+    rd.quadCommands.clear();
+    rd.deferredShaders.clear();
+    rd.quadRecorders.clear();
+    rd.retainedQuadArray.reset();
+    rd.retainedQuadBuffer.reset();
+    rd.retainedChunks.clear();
+    rd.multiDrawTextures.clear();
+    rd.multiDrawVertexArray.reset();
+    rd.multiDrawVertexBuffer.reset();
+    rd.multiDrawCommandBuffer.reset();
+    rd.multiDrawTableBuffer.reset();
+    rd.quadIndexBuffer.reset();
+    rd.gpuTimer.reset();
     rd.quadShader.reset();
+    rd.instancedQuadShader.reset();
+    m_frameUniformBuffer.reset();
   }
 
   Unique<Renderer> Renderer::make ()
@@ -73,10 +227,19 @@ namespace dg
     return std::make_unique<Renderer>();
   }
 
+  void Renderer::beginFrame (const F32 deltaTime, const Vector2f& viewportSize)
+  {
+    m_frameUniforms.time += deltaTime;
+    m_frameUniforms.deltaTime = deltaTime;
+    m_frameUniforms.viewportSize = viewportSize;
+    uploadFrameUniforms();
+  }
+
   void Renderer::useFrameBuffer2D (const Shared<FrameBuffer>& framebuffer)
   {
     if (m_renderData2D.sceneStarted == true) {
-      flushScene2D(true);
+      drainQuadCommands2D();
+      flushScene2D(true, FlushReason2D::FRAMEBUFFER_CHANGE);
 
       if (m_renderData2D.framebuffer != nullptr) {
         m_renderData2D.framebuffer->unbind();
@@ -92,13 +255,14 @@ namespace dg
 
   void Renderer::useQuadShader2D (const Shared<Shader>& shader)
   {
+    if (shader != nullptr) { shader->wait(); }
     if (shader == nullptr || shader->isValid() == false) {
       DG_ENGINE_THROW(std::invalid_argument,
         "Attempt to use null or invalid shader for rendering quads!");
     }
 
     if (m_renderData2D.sceneStarted == true) {
-      flushScene2D(true);
+      flushScene2D(true, FlushReason2D::SHADER_CHANGE);
     }
 
     if (m_renderData2D.quadShader != nullptr) {
@@ -106,12 +270,179 @@ namespace dg
     }
 
     m_renderData2D.quadShader = shader;
-    for (Index i = 0; i < TEXTURE_SLOT_COUNT; ++i) {
-      m_renderData2D.quadShader->setInteger("uni_TexSlots[" + std::to_string(i) + "]", i);
-    }
+    bindQuadSamplers2D(*shader);
 
     if (m_renderData2D.sceneStarted == true) {
-      m_renderData2D.quadShader->setMatrix4f("uni_CameraProduct", m_renderData2D.cameraProduct);
+      slotDeferredShader2D();
+    }
+  }
+
+  void Renderer::useInstancedQuadShader2D (const Shared<Shader>& shader)
+  {
+    RenderData2D& rd = m_renderData2D;
+    if (shader != nullptr) { shader->wait(); }
+    if (shader == nullptr || shader->isValid() == false) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to use null or invalid shader for rendering instanced quads!");
+    }
+
+    if (rd.sceneStarted == true) {
+      flushScene2D(true, FlushReason2D::SHADER_CHANGE);
+    }
+
+    if (rd.instancedQuadShader != nullptr) {
+      rd.instancedQuadShader->unbind();
+    }
+
+    rd.instancedQuadShader = shader;
+    bindQuadSamplers2D(*shader);
+
+    if (rd.sceneStarted == true) {
+      slotDeferredShader2D();
+    }
+  }
+
+  void Renderer::setQuadRenderMode2D (const QuadRenderMode2D mode)
+  {
+    RenderData2D& rd = m_renderData2D;
+    if (rd.quadRenderMode == mode) { return; }
+
+    if (rd.sceneStarted == true) {
+      if (
+        (mode == QuadRenderMode2D::BATCHED && rd.quadShader == nullptr) ||
+        (mode == QuadRenderMode2D::INSTANCED && rd.instancedQuadShader == nullptr)
+      ) {
+        DG_ENGINE_THROW(std::runtime_error,
+          "Attempt to switch 2D quad render mode mid-scene with no shader for the new mode!");
+      }
+
+      drainQuadCommands2D();
+      flushScene2D(true, FlushReason2D::STATE_CHANGE);
+    }
+
+    rd.quadRenderMode = mode;
+    if (rd.sceneStarted == true) {
+      acquireQuadRegion2D();
+      rd.deferredShaders.clear();
+      slotDeferredShader2D();
+    }
+  }
+
+  void Renderer::setTextureBindingMode2D (const TextureBindingMode2D mode)
+  {
+    RenderData2D& rd = m_renderData2D;
+    if (rd.textureBindingMode == mode) { return; }
+
+    // Texture indices mean different things in either mode, so quads already in the batch must be
+    // drawn before the mode changes, and the retained quads' texture indices are all invalidated.
+    if (rd.sceneStarted == true) {
+      drainQuadCommands2D();
+      flushScene2D(true, FlushReason2D::STATE_CHANGE);
+    }
+
+    rd.textureBindingMode = mode;
+    clearRetainedQuads2D();
+  }
+
+  void Renderer::setSubmissionMode2D (const SubmissionMode2D mode)
+  {
+    RenderData2D& rd = m_renderData2D;
+    if (rd.submissionMode == mode) { return; }
+
+    if (rd.sceneStarted == true) {
+      drainQuadCommands2D();
+    }
+
+    rd.submissionMode = mode;
+    if (rd.sceneStarted == true) {
+      rd.deferredShaders.clear();
+      slotDeferredShader2D();
+    }
+  }
+
+  void Renderer::setGpuTimingEnabled2D (bool enabled)
+  {
+    RenderData2D& rd = m_renderData2D;
+    if (rd.sceneStarted == true) {
+      DG_ENGINE_THROW(std::runtime_error,
+        "Attempt to toggle 2D GPU timing mid-scene!");
+    }
+
+    if (enabled == true && rd.gpuTimer == nullptr) {
+      rd.gpuTimer = GpuTimer::make();
+    } else if (enabled == false) {
+      rd.gpuTimer.reset();
+    }
+  }
+
+  void Renderer::setDynamicResolutionEnabled2D (bool enabled,
+    const DynamicResolutionSpecification2D& spec)
+  {
+    RenderData2D& rd = m_renderData2D;
+    if (rd.sceneStarted == true) {
+      DG_ENGINE_THROW(std::runtime_error,
+        "Attempt to toggle 2D dynamic resolution mid-scene!");
+    }
+
+    if (
+      spec.targetGpuTime <= 0.0 || spec.minScale <= 0.0f || spec.minScale > spec.maxScale ||
+      spec.maxScale > 1.0f || spec.scaleStep <= 0.0f
+    ) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to enable 2D dynamic resolution with invalid target or scales!");
+    }
+
+    rd.dynamicResolutionEnabled = enabled;
+    rd.dynamicResolution = spec;
+    rd.overBudgetSceneCount = 0;
+    rd.underBudgetSceneCount = 0;
+    rd.settlingSceneCount = 0;
+
+    if (enabled == true) {
+      setGpuTimingEnabled2D(true);
+    } else if (rd.framebuffer != nullptr) {
+      rd.framebuffer->setRenderScale(1.0f);
+    }
+  }
+
+  void Renderer::setMultiDrawEnabled2D (bool enabled)
+  {
+    RenderData2D& rd = m_renderData2D;
+    if (rd.multiDrawEnabled == enabled) { return; }
+
+    if (rd.sceneStarted == true) {
+      drainQuadCommands2D();
+      flushScene2D(true, FlushReason2D::STATE_CHANGE);
+    }
+
+    // The multi-draw's streaming buffers are only made the first time it is enabled, and the
+    // vertex buffer shares the layout and index buffer of the batched path's.
+    if (enabled == true && rd.multiDrawVertexArray == nullptr) {
+      rd.multiDrawVertexArray = VertexArray::make();
+      rd.multiDrawVertexBuffer = StreamingVertexBuffer::make(
+        RenderData2D::MULTI_DRAW_VERTICES_PER_REGION * sizeof(QuadVertex2D),
+        RenderData2D::STREAMING_REGION_COUNT
+      );
+      rd.multiDrawVertexBuffer->setLayout(rd.quadVertexBuffer->getLayout());
+      rd.multiDrawVertexArray->addVertexBuffer(rd.multiDrawVertexBuffer);
+      rd.multiDrawVertexArray->setIndexBuffer(rd.quadIndexBuffer);
+      rd.multiDrawCommandBuffer = StreamingIndirectBuffer::make(
+        RenderData2D::MULTI_DRAW_COMMANDS_PER_REGION,
+        RenderData2D::STREAMING_REGION_COUNT
+      );
+      rd.multiDrawTableBuffer = StreamingStorageBuffer::make(
+        RenderData2D::MULTI_DRAW_COMMANDS_PER_REGION * TEXTURE_SLOT_COUNT * sizeof(I32),
+        RenderData2D::STREAMING_REGION_COUNT
+      );
+    }
+
+    rd.multiDrawEnabled = enabled;
+    // This must match the number of sampler units quad2d_textures.glsl declares for multi-draw.
+    rd.multiDrawUnitCount =
+      (RenderCommand::getTextureUnitCount() >= RenderData2D::MULTI_DRAW_TEXTURE_UNITS_MAX) ?
+        RenderData2D::MULTI_DRAW_TEXTURE_UNITS_MAX : TEXTURE_SLOT_COUNT;
+    if (rd.sceneStarted == true) {
+      acquireQuadRegion2D();
     }
   }
 
@@ -128,27 +459,46 @@ namespace dg
     }
 
     if (
-      m_renderData2D.quadShader == nullptr
+      (
+        m_renderData2D.quadRenderMode == QuadRenderMode2D::BATCHED &&
+        m_renderData2D.quadShader == nullptr
+      ) || (
+        m_renderData2D.quadRenderMode == QuadRenderMode2D::INSTANCED &&
+        m_renderData2D.instancedQuadShader == nullptr
+      )
     ) {
       DG_ENGINE_THROW(std::runtime_error,
         "Attempt to begin 2D scene with insufficient shaders provided!");
     }
 
+    // The stats are reset first, as that reads back the GPU times which the framebuffer's render
+    // scale is adjusted from, and that must be done before the framebuffer is bound.
+    resetStats2D();
+    updateRenderScale2D();
     if (m_renderData2D.framebuffer != nullptr) {
       m_renderData2D.framebuffer->bind();
     }
 
-    m_renderData2D.cameraProduct = cameraProduct;
-    m_renderData2D.quadShader->setMatrix4f("uni_CameraProduct", m_renderData2D.cameraProduct);
+    // Every quad shader reads the scene's camera from the frame uniform block.
+    m_frameUniforms.cameraProduct = cameraProduct;
+    uploadFrameUniforms();
+
+    m_renderData2D.multiDrawVertexStart = 0;
+    acquireQuadRegion2D();
     m_renderData2D.quadVertexCount = 0;
     m_renderData2D.batchVertexCount = 0;
     m_renderData2D.sceneVertexCount = 0;
     m_renderData2D.quadIndexCount = 0;
+    m_renderData2D.quadInstanceCount = 0;
     m_renderData2D.batchIndexCount = 0;
     m_renderData2D.sceneIndexCount = 0;
     m_renderData2D.batchTextureCount = 1;
-    m_renderData2D.sceneBatchCount = 0;
+    m_renderData2D.batchArrayCount = 0;
+    m_renderData2D.quadCommands.clear();
+    m_renderData2D.quadSortEntries.clear();
+    m_renderData2D.deferredShaders.clear();
     m_renderData2D.sceneStarted = true;
+    slotDeferredShader2D();
   }
 
   void Renderer::endScene2D ()
@@ -158,7 +508,11 @@ namespace dg
         "Attempt to end 2D scene when no such scene was started!");
     }
 
-    flushScene2D(false);
+    drainQuadCommands2D();
+    flushScene2D(false, FlushReason2D::END_OF_SCENE);
+    if (m_renderData2D.gpuTimer != nullptr) {
+      m_renderData2D.gpuTimer->endFrame();
+    }
 
     if (m_renderData2D.framebuffer != nullptr) {
       m_renderData2D.framebuffer->unbind();
@@ -167,80 +521,775 @@ namespace dg
     m_renderData2D.sceneStarted = false;
   }
 
-  void Renderer::flushScene2D (bool early)
+  void Renderer::flushScene2D (bool early, const FlushReason2D reason)
   {
     if (m_renderData2D.sceneStarted == false) {
       DG_ENGINE_THROW(std::runtime_error,
         "Attempt to flush 2D scene when no such scene was started!");
     }
 
-    if (m_renderData2D.quadVertexCount > 0) {
-      m_renderData2D.quadVertexBuffer->uploadFrom<QuadVertex2D>(
-        m_renderData2D.quadVertices, m_renderData2D.quadVertexCount
-      );
-      
-      for (Index i = 0; i < m_renderData2D.batchTextureCount; ++i) {
-        m_renderData2D.textures[i]->bind(i);
+    // The batch's vertices (or instances) were written straight into a streaming buffer's mapped
+    // region, so the batch is drawn from that region in place, then the region is fenced and
+    // released. Only the indices submitted to the batch are drawn.
+    //
+    // In multi-draw mode, the batch is instead closed off as one draw of the pending multi-draw,
+    // which is only submitted, and its vertex region released, once the batch was closed for a
+    // reason other than its capacity.
+    RenderData2D& rd = m_renderData2D;
+    if (isMultiDrawActive2D() == true) {
+      if (rd.quadVertexCount > 0) {
+        closeMultiDraw2D();
+        rd.stats.drawIndexCount += rd.quadIndexCount;
+        rd.stats.batchCount++;
+        rd.stats.flushCounts[static_cast<Index>(reason)]++;
       }
 
-      m_renderData2D.quadShader->bind();
-      RenderCommand::drawIndexed(m_renderData2D.quadVertexArray, m_renderData2D.quadIndexCount);
+      if (
+        reason != FlushReason2D::VERTEX_CAPACITY &&
+        reason != FlushReason2D::INDEX_CAPACITY &&
+        reason != FlushReason2D::TEXTURE_SLOTS
+      ) {
+        submitMultiDraw2D();
+        releaseMultiDrawRegion2D();
+      }
+    } else if (rd.quadVertexCount > 0) {
+      if (rd.textureBindingMode == TextureBindingMode2D::ARRAYS) {
+        for (Index i = 0; i < rd.batchArrayCount; ++i) {
+          rd.arrayPages[rd.batchArrays[i]].array->bind(i);
+        }
+        rd.stats.textureBindCount += rd.batchArrayCount;
+      } else {
+        for (Index i = 0; i < rd.batchTextureCount; ++i) {
+          rd.textures[i]->bind(i);
+        }
+        rd.stats.textureBindCount += rd.batchTextureCount;
+      }
+
+      if (rd.gpuTimer != nullptr) { rd.gpuTimer->beginRange(); }
+
+      if (rd.quadRenderMode == QuadRenderMode2D::INSTANCED) {
+        rd.instancedQuadShader->bind();
+        RenderCommand::drawIndexedInstanced(
+          rd.quadInstanceArray,
+          6,
+          rd.quadInstanceCount,
+          rd.quadInstanceBuffer->getRegionOffset() / sizeof(QuadInstance2D)
+        );
+        rd.quadInstanceBuffer->releaseRegion();
+        rd.quadInstances = nullptr;
+        rd.stats.uploadSize += rd.quadInstanceCount * sizeof(QuadInstance2D);
+      } else {
+        rd.quadShader->bind();
+        RenderCommand::drawIndexed(
+          rd.quadVertexArray,
+          rd.quadIndexCount,
+          rd.quadVertexBuffer->getRegionOffset() / sizeof(QuadVertex2D)
+        );
+        rd.quadVertexBuffer->releaseRegion();
+        rd.quadVertices = nullptr;
+        rd.stats.uploadSize += rd.quadVertexCount * sizeof(QuadVertex2D);
+      }
+
+      if (rd.gpuTimer != nullptr) { rd.gpuTimer->endRange(); }
+      rd.stats.drawIndexCount += rd.quadIndexCount;
+      rd.stats.batchCount++;
+      rd.stats.flushCounts[static_cast<Index>(reason)]++;
     }
 
     if (early == true) {
+      acquireQuadRegion2D();
       m_renderData2D.quadVertexCount = 0;
       m_renderData2D.batchVertexCount = 0;
       m_renderData2D.quadIndexCount = 0;
+      m_renderData2D.quadInstanceCount = 0;
       m_renderData2D.batchIndexCount = 0;
       m_renderData2D.batchTextureCount = 1;
+      m_renderData2D.batchArrayCount = 0;
     }
-
-    m_renderData2D.sceneBatchCount++;
   }
 
   void Renderer::submitQuad2D (const Matrix4f& transform, const RenderSpecification2D& spec)
+  {
+    submitQuadCommand2D(makeQuadCommand2D(transform, spec), spec.layer);
+  }
+
+  void Renderer::submitQuad2D (const QuadTransform2D& transform, const RenderSpecification2D& spec)
+  {
+    submitQuadCommand2D(makeQuadCommand2D(transform, spec), spec.layer);
+  }
+
+  void Renderer::submitQuad2D (const Vector3f& position, const Vector2f& size, const F32 rotation,
+    const RenderSpecification2D& spec)
+  {
+    // The quad's corners follow directly from its position, size, and the sine and cosine of its
+    // rotation; no matrices are needed.
+    submitQuad2D(QuadTransform2D::fromTRS(position, size, rotation), spec);
+  }
+
+  void Renderer::reserveQuadRecorders2D (const Count count)
+  {
+    RenderData2D& rd = m_renderData2D;
+    while (rd.quadRecorders.size() < count) {
+      rd.quadRecorders.push_back(std::make_unique<QuadRecorder2D>());
+    }
+  }
+
+  QuadRecorder2D& Renderer::getQuadRecorder2D (const Index index)
+  {
+    if (index >= m_renderData2D.quadRecorders.size()) {
+      DG_ENGINE_THROW(std::out_of_range,
+        "Attempt to get out of range 2D quad recorder {}!", index);
+    }
+
+    return *m_renderData2D.quadRecorders[index];
+  }
+
+  void Renderer::mergeQuadRecorders2D ()
   {
     RenderData2D& rd = m_renderData2D;
     if (rd.sceneStarted == false) {
       DG_ENGINE_THROW(std::runtime_error,
-        "Attempt to submit a 2D quad to a scene when no such scene is started!");
+        "Attempt to merge 2D quad recorders when no scene is started!");
     }
 
-    F32 texIndex = static_cast<F32>(slotTexture2D(spec.texture));
-    F32 entityId = static_cast<F32>(spec.entityId);
-    Vector3f positions[4] = {
-      (transform * rd.quadVertexPositions[0]).getVector3(),
-      (transform * rd.quadVertexPositions[1]).getVector3(),
-      (transform * rd.quadVertexPositions[2]).getVector3(),
-      (transform * rd.quadVertexPositions[3]).getVector3()
-    };
+    for (auto& recorder : rd.quadRecorders) {
+      if (rd.submissionMode == SubmissionMode2D::DEFERRED) {
+        U64 shaderBits = static_cast<U64>(rd.deferredShaderSlot) << 48;
+        for (Index i = 0; i < recorder->m_commands.size(); ++i) {
+          rd.quadSortEntries.push_back({
+            recorder->m_keys[i] | shaderBits,
+            static_cast<U32>(rd.quadCommands.size())
+          });
+          rd.quadCommands.push_back(std::move(recorder->m_commands[i]));
+        }
+      } else {
+        for (const auto& command : recorder->m_commands) {
+          emitQuad2D(command);
+        }
+      }
 
-    submitQuadVertex2D({ positions[0], rd.quadTexCoords[0], spec.color, texIndex, entityId });
-    submitQuadVertex2D({ positions[1], rd.quadTexCoords[1], spec.color, texIndex, entityId });
-    submitQuadVertex2D({ positions[2], rd.quadTexCoords[2], spec.color, texIndex, entityId });
-    submitQuadVertex2D({ positions[3], rd.quadTexCoords[3], spec.color, texIndex, entityId });
+      recorder->clear();
+    }
+  }
 
-    rd.quadIndexCount += 6;
-    rd.batchIndexCount += 6;
-    rd.sceneIndexCount += 6;
+  void Renderer::uploadFrameUniforms ()
+  {
+    m_frameUniformBuffer->upload(&m_frameUniforms, sizeof(FrameUniforms));
+    m_frameUniformBuffer->bind(FRAME_UNIFORM_BINDING);
+  }
+
+  void Renderer::resetStats2D ()
+  {
+    // Beginning the GPU timer's frame reads back the results of an earlier scene, if they are done.
+    RenderData2D& rd = m_renderData2D;
+    rd.stats = {};
+    if (rd.gpuTimer != nullptr) {
+      rd.gpuTimer->beginFrame();
+      rd.stats.gpuTimesValid = rd.gpuTimer->hasResults();
+      rd.stats.gpuTimesNew = rd.gpuTimer->hasNewResults();
+      rd.stats.gpuTimeLatency = rd.gpuTimer->getLatency();
+      rd.stats.gpuSceneTime = rd.gpuTimer->getFrameTime();
+      rd.stats.gpuBatchTimes = rd.gpuTimer->getRangeTimes();
+    }
+  }
 
+  void Renderer::updateRenderScale2D ()
+  {
+    RenderData2D& rd = m_renderData2D;
     if (
-      rd.quadVertexCount    >= RenderData2D::VERTICES_PER_BATCH ||
-      rd.quadIndexCount     >= RenderData2D::INDICES_PER_BATCH ||
-      rd.batchTextureCount  >= TEXTURE_SLOT_COUNT
+      rd.dynamicResolutionEnabled == false ||
+      rd.framebuffer == nullptr
     ) {
-      flushScene2D(true);
+      return;
+    }
+
+    // The GPU times read back describe a scene drawn some scenes ago, so those drawn before the last
+    // change of scale say nothing about the new one.
+    if (rd.settlingSceneCount > 0) {
+      rd.settlingSceneCount--;
+      return;
+    }
+
+    // Times kept from an earlier scene, because this one's were discarded, were already counted.
+    if (rd.stats.gpuTimesNew == false) {
+      return;
+    }
+
+    const DynamicResolutionSpecification2D& spec = rd.dynamicResolution;
+    F64 gpuTime = rd.stats.gpuSceneTime;
+    if (gpuTime > spec.targetGpuTime * (1.0 + spec.tolerance)) {
+      rd.overBudgetSceneCount++;
+      rd.underBudgetSceneCount = 0;
+    } else if (gpuTime < spec.targetGpuTime * (1.0 - spec.tolerance)) {
+      rd.underBudgetSceneCount++;
+      rd.overBudgetSceneCount = 0;
+    } else {
+      rd.overBudgetSceneCount = 0;
+      rd.underBudgetSceneCount = 0;
+    }
+
+    F32 scale = clamp(rd.framebuffer->getRenderScale(), spec.minScale, spec.maxScale);
+    if (rd.overBudgetSceneCount >= spec.downscaleSceneCount) {
+      scale = std::max(scale - spec.scaleStep, spec.minScale);
+    } else if (rd.underBudgetSceneCount >= spec.upscaleSceneCount) {
+      scale = std::min(scale + spec.scaleStep, spec.maxScale);
+    }
+
+    if (floatEquals(scale, rd.framebuffer->getRenderScale()) == false) {
+      rd.framebuffer->setRenderScale(scale);
+      rd.overBudgetSceneCount = 0;
+      rd.underBudgetSceneCount = 0;
+      rd.settlingSceneCount = rd.stats.gpuTimeLatency;
     }
   }
 
-  void Renderer::submitQuad2D (const Vector3f& position, const Vector2f& size, const F32 rotation,
+  void Renderer::submitQuadCommand2D (QuadCommand2D&& command, const U8 layer)
+  {
+    RenderData2D& rd = m_renderData2D;
+    if (rd.sceneStarted == false) {
+      DG_ENGINE_THROW(std::runtime_error,
+        "Attempt to submit a 2D quad to a scene when no such scene is started!");
+    }
+
+    if (rd.submissionMode == SubmissionMode2D::IMMEDIATE) {
+      emitQuad2D(command);
+      return;
+    }
+
+    U64 key = makeQuadSortKey2D(command, layer) |
+      (static_cast<U64>(rd.deferredShaderSlot) << 48);
+    rd.quadSortEntries.push_back({ key, static_cast<U32>(rd.quadCommands.size()) });
+    rd.quadCommands.push_back(std::move(command));
+  }
+
+  Index Renderer::addRetainedQuad2D (const Matrix4f& transform, const RenderSpecification2D& spec)
+  {
+    RenderData2D& rd = m_renderData2D;
+
+    Index handle = 0;
+    if (rd.freeRetainedQuads.empty() == false) {
+      handle = rd.freeRetainedQuads.back();
+      rd.freeRetainedQuads.pop_back();
+    } else {
+      handle = rd.retainedQuads.size();
+      rd.retainedQuads.emplace_back();
+    }
+
+    QuadCommand2D command = makeQuadCommand2D(transform, spec);
+    I32 texIndex = 0;
+    Index instance = placeRetainedQuad2D(handle, command.texture, texIndex);
+    writeRetainedQuad2D(instance, command, texIndex);
+    rd.retainedQuadCount++;
+    return handle;
+  }
+
+  void Renderer::updateRetainedQuad2D (const Index handle, const Matrix4f& transform,
     const RenderSpecification2D& spec)
   {
-    Matrix4f transform = translate(Matrix4f::IDENTITY, position);
-    transform = rotate(transform, radians(rotation), { 0.0f, 0.0f, 1.0f });
-    transform = scale(transform, { size.x, size.y, 1.0f });
+    RenderData2D& rd = m_renderData2D;
+    if (handle >= rd.retainedQuads.size() || rd.retainedQuads[handle].live == false) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to update invalid retained 2D quad {}!", handle);
+    }
+
+    // The quad is rewritten in place if its chunk can take its texture; otherwise, it moves to a
+    // chunk which can.
+    QuadCommand2D command = makeQuadCommand2D(transform, spec);
+    RetainedQuad2D& quad = rd.retainedQuads[handle];
+    RetainedQuadChunk2D& chunk = rd.retainedChunks[quad.chunk];
+    I32 texIndex = 0;
+    I32 chunkTexture = 0;
+    if (bindRetainedTexture2D(chunk, command.texture, texIndex, chunkTexture) == true) {
+      // The new texture's slot is taken before the old one is given up, so that a quad keeping its
+      // texture never empties its slot.
+      useRetainedTextureSlot2D(chunk, chunkTexture);
+      releaseRetainedTextureSlot2D(chunk, quad.chunkTexture);
+      quad.chunkTexture = chunkTexture;
+      writeRetainedQuad2D(quad.chunk * RenderData2D::RETAINED_QUADS_PER_CHUNK + quad.slot, command,
+        texIndex);
+    } else {
+      releaseRetainedQuad2D(handle);
+      Index instance = placeRetainedQuad2D(handle, command.texture, texIndex);
+      writeRetainedQuad2D(instance, command, texIndex);
+    }
+  }
+
+  void Renderer::removeRetainedQuad2D (const Index handle)
+  {
+    RenderData2D& rd = m_renderData2D;
+    if (handle >= rd.retainedQuads.size() || rd.retainedQuads[handle].live == false) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to remove invalid retained 2D quad {}!", handle);
+    }
+
+    releaseRetainedQuad2D(handle);
+    rd.freeRetainedQuads.push_back(handle);
+    rd.retainedQuadCount--;
+  }
+
+  void Renderer::clearRetainedQuads2D ()
+  {
+    RenderData2D& rd = m_renderData2D;
+    rd.retainedInstances.clear();
+    rd.retainedChunks.clear();
+    rd.retainedQuads.clear();
+    rd.freeRetainedQuads.clear();
+    rd.dirtyRetainedInstances.clear();
+    rd.retainedQuadCount = 0;
+    rd.retainedBufferStale = true;
+    rd.retainedGeneration++;
+  }
+
+  void Renderer::drawRetainedQuads2D ()
+  {
+    RenderData2D& rd = m_renderData2D;
+    if (rd.sceneStarted == false) {
+      DG_ENGINE_THROW(std::runtime_error,
+        "Attempt to draw retained 2D quads when no scene is started!");
+    }
+
+    if (rd.instancedQuadShader == nullptr) {
+      DG_ENGINE_THROW(std::runtime_error,
+        "Attempt to draw retained 2D quads with no instanced quad shader provided!");
+    }
+
+    if (rd.retainedQuadCount == 0) { return; }
+
+    // Quads already in the batch were submitted first, so they are drawn first.
+    if (hasPendingQuads2D() == true) {
+      flushScene2D(true, FlushReason2D::RETAINED_QUADS);
+    }
+
+    // Refreshing a chunk may move quads out of it, into later (or new) chunks, so every chunk is
+    // refreshed before the retained quads are uploaded.
+    if (rd.textureBindingMode == TextureBindingMode2D::ARRAYS) {
+      for (Index i = 0; i < rd.retainedChunks.size(); ++i) {
+        if (rd.retainedChunks[i].liveCount > 0) {
+          refreshRetainedChunk2D(i);
+        }
+      }
+    }
+
+    uploadRetainedQuads2D();
+
+    rd.instancedQuadShader->bind();
+    for (Index i = 0; i < rd.retainedChunks.size(); ++i) {
+      RetainedQuadChunk2D& chunk = rd.retainedChunks[i];
+      if (chunk.liveCount == 0) { continue; }
+
+      if (rd.textureBindingMode == TextureBindingMode2D::ARRAYS) {
+        for (Index j = 0; j < chunk.pages.size(); ++j) {
+          rd.arrayPages[chunk.pages[j]].array->bind(j);
+        }
+        rd.stats.textureBindCount += chunk.pages.size();
+      } else {
+        for (Index j = 0; j < chunk.textures.size(); ++j) {
+          if (chunk.textures[j] == nullptr) { continue; }
 
-    submitQuad2D(transform, spec);
+          chunk.textures[j]->bind(j);
+          rd.stats.textureBindCount++;
+        }
+      }
+
+      if (rd.gpuTimer != nullptr) { rd.gpuTimer->beginRange(); }
+      RenderCommand::drawIndexedInstanced(
+        rd.retainedQuadArray,
+        6,
+        chunk.usedCount,
+        i * RenderData2D::RETAINED_QUADS_PER_CHUNK
+      );
+      if (rd.gpuTimer != nullptr) { rd.gpuTimer->endRange(); }
+
+      rd.stats.drawIndexCount += chunk.usedCount * 6;
+      rd.stats.batchCount++;
+    }
+  }
+
+  Index Renderer::placeRetainedQuad2D (const Index handle, const Shared<Texture>& texture,
+    I32& texIndex)
+  {
+    RenderData2D& rd = m_renderData2D;
+
+    // Find the first chunk with a free slot which can take the quad's texture, adding a new chunk
+    // if there is none. Adding a chunk grows the retained quad buffer, which is then recreated
+    // in full on the next draw. The caller writes the quad into the returned instance.
+    I32 chunkTexture = 0;
+    Index chunkIndex = 0;
+    while (chunkIndex < rd.retainedChunks.size()) {
+      RetainedQuadChunk2D& chunk = rd.retainedChunks[chunkIndex];
+      if (
+        (
+          chunk.freeSlots.empty() == false ||
+          chunk.usedCount < RenderData2D::RETAINED_QUADS_PER_CHUNK
+        ) &&
+        bindRetainedTexture2D(chunk, texture, texIndex, chunkTexture) == true
+      ) {
+        break;
+      }
+
+      ++chunkIndex;
+    }
+
+    if (chunkIndex == rd.retainedChunks.size()) {
+      rd.retainedChunks.emplace_back();
+      rd.retainedInstances.resize(rd.retainedChunks.size() * RenderData2D::RETAINED_QUADS_PER_CHUNK,
+        QuadInstance2D {});
+      rd.retainedBufferStale = true;
+      bindRetainedTexture2D(rd.retainedChunks.back(), texture, texIndex, chunkTexture);
+    }
+
+    RetainedQuadChunk2D& chunk = rd.retainedChunks[chunkIndex];
+    U32 slot = 0;
+    if (chunk.freeSlots.empty() == false) {
+      slot = chunk.freeSlots.back();
+      chunk.freeSlots.pop_back();
+      chunk.quadHandles[slot] = handle;
+    } else {
+      slot = chunk.usedCount++;
+      chunk.quadHandles.push_back(handle);
+    }
+    chunk.liveCount++;
+    useRetainedTextureSlot2D(chunk, chunkTexture);
+
+    rd.retainedQuads[handle] = { chunkIndex, slot, chunkTexture, true };
+    return chunkIndex * RenderData2D::RETAINED_QUADS_PER_CHUNK + slot;
+  }
+
+  void Renderer::releaseRetainedQuad2D (const Index handle)
+  {
+    // A released slot is overwritten with a degenerate instance, which covers no pixels, until it
+    // is handed out again. A chunk left with no quads forgets its textures.
+    RenderData2D& rd = m_renderData2D;
+    RetainedQuad2D& quad = rd.retainedQuads[handle];
+    RetainedQuadChunk2D& chunk = rd.retainedChunks[quad.chunk];
+
+    Index instance = quad.chunk * RenderData2D::RETAINED_QUADS_PER_CHUNK + quad.slot;
+    rd.retainedInstances[instance] = {};
+    rd.dirtyRetainedInstances.push_back(instance);
+
+    chunk.freeSlots.push_back(quad.slot);
+    releaseRetainedTextureSlot2D(chunk, quad.chunkTexture);
+    if (--chunk.liveCount == 0) {
+      chunk.textures.clear();
+      chunk.textureUseCounts.clear();
+      chunk.textureIndices.clear();
+      chunk.pages.clear();
+      chunk.quadHandles.clear();
+      chunk.freeSlots.clear();
+      chunk.usedCount = 0;
+    }
+
+    quad.live = false;
+  }
+
+  void Renderer::useRetainedTextureSlot2D (RetainedQuadChunk2D& chunk, const I32 chunkTexture)
+  {
+    if (chunkTexture >= 0) {
+      chunk.textureUseCounts[chunkTexture]++;
+    }
+  }
+
+  void Renderer::releaseRetainedTextureSlot2D (RetainedQuadChunk2D& chunk, const I32 chunkTexture)
+  {
+    // In slots mode, the blank texture keeps the first slot for as long as the chunk has quads.
+    // Untextured quads in texture array mode use none of the chunk's textures.
+    if (chunkTexture < 0 || --chunk.textureUseCounts[chunkTexture] > 0) { return; }
+
+    if (m_renderData2D.textureBindingMode == TextureBindingMode2D::ARRAYS) {
+      chunk.textures[chunkTexture] = nullptr;
+      chunk.textureIndices[chunkTexture] = -1;
+    } else if (chunkTexture != 0) {
+      chunk.textures[chunkTexture] = nullptr;
+    }
+  }
+
+  bool Renderer::bindRetainedTexture2D (RetainedQuadChunk2D& chunk,
+    const Shared<Texture>& texture, I32& texIndex, I32& chunkTexture)
+  {
+    RenderData2D& rd = m_renderData2D;
+    bool textured = (texture != nullptr && texture->isValid() == true);
+
+    if (rd.textureBindingMode == TextureBindingMode2D::SLOTS) {
+      // As with batches, the blank texture always occupies the first slot.
+      if (chunk.textures.empty() == true) {
+        chunk.textures.push_back(rd.blankTexture);
+        chunk.textureUseCounts.push_back(0);
+      }
+
+      // A new texture goes into the first emptied slot, if there is one.
+      const Shared<Texture>& bound = (textured == true) ? texture : rd.blankTexture;
+      auto iter = std::find(chunk.textures.begin(), chunk.textures.end(), bound);
+      if (iter == chunk.textures.end()) {
+        iter = std::find(chunk.textures.begin(), chunk.textures.end(), nullptr);
+        if (iter != chunk.textures.end()) {
+          *iter = bound;
+        } else if (chunk.textures.size() < TEXTURE_SLOT_COUNT) {
+          iter = chunk.textures.insert(chunk.textures.end(), bound);
+          chunk.textureUseCounts.push_back(0);
+        } else {
+          return false;
+        }
+      }
+
+      texIndex = static_cast<I32>(iter - chunk.textures.begin());
+      chunkTexture = texIndex;
+      return true;
+    }
+
+    if (textured == false) {
+      texIndex = -1;
+      chunkTexture = -1;
+      return true;
+    }
+
+    Index page = 0;
+    U32 layer = 0;
+    resolveTextureLayer2D(texture, page, layer);
+
+    // A texture already in the chunk is written with the texture index its other quads were. If
+    // the texture has since moved, the chunk's next refresh rewrites all of them at once.
+    auto textureIter = std::find(chunk.textures.begin(), chunk.textures.end(), texture);
+    if (textureIter != chunk.textures.end()) {
+      chunkTexture = static_cast<I32>(textureIter - chunk.textures.begin());
+      texIndex = chunk.textureIndices[chunkTexture];
+      return true;
+    }
+
+    auto pageIter = std::find(chunk.pages.begin(), chunk.pages.end(), page);
+    if (pageIter == chunk.pages.end()) {
+      if (chunk.pages.size() >= TEXTURE_SLOT_COUNT) { return false; }
+      pageIter = chunk.pages.insert(chunk.pages.end(), page);
+    }
+
+    // A new texture goes into the first emptied place in the chunk's textures, if there is one.
+    texIndex = static_cast<I32>(((pageIter - chunk.pages.begin()) << 16) | layer);
+    textureIter = std::find(chunk.textures.begin(), chunk.textures.end(), nullptr);
+    if (textureIter == chunk.textures.end()) {
+      textureIter = chunk.textures.insert(chunk.textures.end(), nullptr);
+      chunk.textureUseCounts.push_back(0);
+      chunk.textureIndices.push_back(-1);
+    }
+
+    chunkTexture = static_cast<I32>(textureIter - chunk.textures.begin());
+    chunk.textures[chunkTexture] = texture;
+    chunk.textureIndices[chunkTexture] = texIndex;
+    return true;
+  }
+
+  void Renderer::refreshRetainedChunk2D (const Index chunkIndex)
+  {
+    // Re-resolving the chunk's textures recopies any whose contents changed, and moves any whose
+    // storage was swapped for one which no longer fits its page to another layer, or page. The
+    // chunk's pages are then rebuilt from those its textures are on, keeping each page which is
+    // still used in its place, and the quads of every texture whose index changed are rewritten.
+    RenderData2D& rd = m_renderData2D;
+    RetainedQuadChunk2D& chunk = rd.retainedChunks[chunkIndex];
+    Count textureCount = chunk.textures.size();
+    Collection<Index> texturePages(textureCount, 0);
+    Collection<U32> textureLayers(textureCount, 0);
+    for (Index i = 0; i < textureCount; ++i) {
+      if (chunk.textures[i] != nullptr) {
+        resolveTextureLayer2D(chunk.textures[i], texturePages[i], textureLayers[i]);
+      }
+    }
+
+    auto isPageUsed = [&] (const Index page) {
+      for (Index i = 0; i < textureCount; ++i) {
+        if (chunk.textures[i] != nullptr && texturePages[i] == page) { return true; }
+      }
+
+      return false;
+    };
+
+    Collection<Index> pages;
+    for (Index page : chunk.pages) {
+      if (isPageUsed(page) == true) { pages.push_back(page); }
+    }
+
+    for (Index i = 0; i < textureCount; ++i) {
+      if (
+        chunk.textures[i] != nullptr &&
+        std::find(pages.begin(), pages.end(), texturePages[i]) == pages.end()
+      ) {
+        pages.push_back(texturePages[i]);
+      }
+    }
+
+    // A texture whose page no longer fits the chunk's texture slots is marked with a texture index
+    // of -1; its quads are moved to other chunks below.
+    bool rewrite = (pages != chunk.pages);
+    for (Index i = 0; i < textureCount; ++i) {
+      if (chunk.textures[i] == nullptr) { continue; }
+
+      Index slot = std::find(pages.begin(), pages.end(), texturePages[i]) - pages.begin();
+      I32 texIndex = (slot < TEXTURE_SLOT_COUNT) ?
+        static_cast<I32>((slot << 16) | textureLayers[i]) : -1;
+      if (texIndex != chunk.textureIndices[i]) {
+        chunk.textureIndices[i] = texIndex;
+        rewrite = true;
+      }
+    }
+
+    if (pages.size() > TEXTURE_SLOT_COUNT) {
+      pages.resize(TEXTURE_SLOT_COUNT);
+    }
+
+    chunk.pages = std::move(pages);
+    if (rewrite == false) { return; }
+
+    struct MovedQuad2D
+    {
+      U32 handle;
+      Shared<Texture> texture;
+      QuadInstance2D instance;
+    };
+
+    Collection<MovedQuad2D> movedQuads;
+    Index firstInstance = chunkIndex * RenderData2D::RETAINED_QUADS_PER_CHUNK;
+    for (U32 slot = 0; slot < chunk.usedCount; ++slot) {
+      U32 handle = chunk.quadHandles[slot];
+      const RetainedQuad2D& quad = rd.retainedQuads[handle];
+      if (
+        quad.live == false || quad.chunk != chunkIndex || quad.slot != slot ||
+        quad.chunkTexture < 0
+      ) {
+        continue;
+      }
+
+      QuadInstance2D& instance = rd.retainedInstances[firstInstance + slot];
+      I32 texIndex = chunk.textureIndices[quad.chunkTexture];
+      if (texIndex < 0) {
+        movedQuads.push_back({ handle, chunk.textures[quad.chunkTexture], instance });
+      } else if (instance.texIndex != texIndex) {
+        instance.texIndex = texIndex;
+        rd.dirtyRetainedInstances.push_back(firstInstance + slot);
+      }
+    }
+
+    // Every quad is released before any is placed again, so that the textures they are leaving
+    // are dropped from this chunk by then, rather than taking the quads straight back.
+    for (const MovedQuad2D& moved : movedQuads) {
+      releaseRetainedQuad2D(moved.handle);
+    }
+
+    for (MovedQuad2D& moved : movedQuads) {
+      Index instance = placeRetainedQuad2D(moved.handle, moved.texture, moved.instance.texIndex);
+      rd.retainedInstances[instance] = moved.instance;
+      rd.dirtyRetainedInstances.push_back(instance);
+    }
+  }
+
+  void Renderer::writeRetainedQuad2D (const Index instance, const QuadCommand2D& command,
+    const I32 texIndex)
+  {
+    RenderData2D& rd = m_renderData2D;
+    rd.retainedInstances[instance] = {
+      { command.axisX.x, command.axisX.y, command.axisY.x, command.axisY.y },
+      command.origin,
+      command.color,
+      texIndex,
+      command.entityId,
+      command.texRect
+    };
+
+    rd.dirtyRetainedInstances.push_back(instance);
+  }
+
+  void Renderer::uploadRetainedQuads2D ()
+  {
+    RenderData2D& rd = m_renderData2D;
+    if (rd.retainedBufferStale == true) {
+      rd.retainedQuadBuffer = VertexBuffer::makeFrom(rd.retainedInstances, true);
+      rd.retainedQuadBuffer->setLayout(rd.quadInstanceBuffer->getLayout());
+      rd.retainedQuadArray = VertexArray::make();
+      rd.retainedQuadArray->addVertexBuffer(rd.quadCornerBuffer);
+      rd.retainedQuadArray->addVertexBuffer(rd.retainedQuadBuffer);
+      rd.retainedQuadArray->setIndexBuffer(rd.quadIndexBuffer);
+      rd.stats.uploadSize += rd.retainedInstances.size() * sizeof(QuadInstance2D);
+      rd.dirtyRetainedInstances.clear();
+      rd.retainedBufferStale = false;
+      return;
+    }
+
+    // Upload the changed instances in runs, merging runs separated by only a few unchanged
+    // instances; re-uploading those is cheaper than an extra upload call.
+    Collection<U32>& dirty = rd.dirtyRetainedInstances;
+    if (dirty.empty() == true) { return; }
+
+    std::sort(dirty.begin(), dirty.end());
+    Index runBegin = dirty[0], runEnd = dirty[0] + 1;
+    auto uploadRun = [&] () {
+      Size size = (runEnd - runBegin) * sizeof(QuadInstance2D);
+      rd.retainedQuadBuffer->uploadRange(&rd.retainedInstances[runBegin], size,
+        runBegin * sizeof(QuadInstance2D));
+      rd.stats.uploadSize += size;
+    };
+
+    for (Index i = 1; i < dirty.size(); ++i) {
+      if (dirty[i] < runEnd + RenderData2D::RETAINED_DIRTY_GAP) {
+        runEnd = std::max<Index>(runEnd, dirty[i] + 1);
+      } else {
+        uploadRun();
+        runBegin = dirty[i];
+        runEnd = dirty[i] + 1;
+      }
+    }
+
+    uploadRun();
+    dirty.clear();
+  }
+
+  void Renderer::emitQuad2D (const QuadCommand2D& command)
+  {
+    RenderData2D& rd = m_renderData2D;
+    I32 texIndex = (rd.textureBindingMode == TextureBindingMode2D::ARRAYS) ?
+      slotTextureLayer2D(command.texture) :
+      static_cast<I32>(slotTexture2D(command.texture));
+    const Vector4<U16>& texRect = command.texRect;
+
+    if (rd.quadRenderMode == QuadRenderMode2D::INSTANCED) {
+      submitQuadInstance2D({
+        { command.axisX.x, command.axisX.y, command.axisY.x, command.axisY.y },
+        command.origin,
+        command.color,
+        texIndex,
+        command.entityId,
+        texRect
+      });
+    } else {
+      Vector3f halfX = command.axisX * 0.5f;
+      Vector3f halfY = command.axisY * 0.5f;
+      Vector3f positions[4] = {
+        command.origin - halfX - halfY,
+        command.origin + halfX - halfY,
+        command.origin + halfX + halfY,
+        command.origin - halfX + halfY
+      };
+
+      submitQuadVertex2D({ positions[0], { texRect.x, texRect.y }, command.color, texIndex,
+        command.entityId });
+      submitQuadVertex2D({ positions[1], { texRect.z, texRect.y }, command.color, texIndex,
+        command.entityId });
+      submitQuadVertex2D({ positions[2], { texRect.z, texRect.w }, command.color, texIndex,
+        command.entityId });
+      submitQuadVertex2D({ positions[3], { texRect.x, texRect.w }, command.color, texIndex,
+        command.entityId });
+    }
+
+    rd.quadIndexCount += 6;
+    rd.batchIndexCount += 6;
+    rd.sceneIndexCount += 6;
+
+    if (rd.quadVertexCount >= RenderData2D::VERTICES_PER_BATCH) {
+      flushScene2D(true, FlushReason2D::VERTEX_CAPACITY);
+    } else if (rd.quadIndexCount >= RenderData2D::INDICES_PER_BATCH) {
+      flushScene2D(true, FlushReason2D::INDEX_CAPACITY);
+    } else if (
+      rd.batchTextureCount  >= TEXTURE_SLOT_COUNT ||
+      rd.batchArrayCount    >= TEXTURE_SLOT_COUNT
+    ) {
+      flushScene2D(true, FlushReason2D::TEXTURE_SLOTS);
+    }
   }
 
   void Renderer::submitQuadVertex2D (const QuadVertex2D& vertex)
@@ -250,6 +1299,31 @@ namespace dg
     m_renderData2D.sceneVertexCount++;
   }
 
+  void Renderer::submitQuadInstance2D (const QuadInstance2D& instance)
+  {
+    // An instance stands in for the quad's four vertices, which are still counted as such so that
+    // the batch capacity and the scene's statistics mean the same thing in either render mode.
+    m_renderData2D.quadInstances[m_renderData2D.quadInstanceCount++] = instance;
+    m_renderData2D.quadVertexCount += 4;
+    m_renderData2D.batchVertexCount += 4;
+    m_renderData2D.sceneVertexCount += 4;
+  }
+
+  void Renderer::acquireQuadRegion2D ()
+  {
+    RenderData2D& rd = m_renderData2D;
+    if (rd.quadRenderMode == QuadRenderMode2D::INSTANCED) {
+      rd.quadInstances = rd.quadInstanceBuffer->acquireRegionAs<QuadInstance2D>();
+    } else if (rd.multiDrawEnabled == true) {
+      // In multi-draw mode, batches are written one after another into the multi-draw's vertex
+      // region, which always has room for a full batch past the last one closed.
+      rd.quadVertices = rd.multiDrawVertexBuffer->acquireRegionAs<QuadVertex2D>() +
+        rd.multiDrawVertexStart;
+    } else {
+      rd.quadVertices = rd.quadVertexBuffer->acquireRegionAs<QuadVertex2D>();
+    }
+  }
+
   Index Renderer::slotTexture2D (const Shared<Texture>& texture)
   {
     if (texture == nullptr) { return 0; }
@@ -269,4 +1343,392 @@ namespace dg
     return m_renderData2D.batchTextureCount++;
   }
 
+  I32 Renderer::slotTextureLayer2D (const Shared<Texture>& texture)
+  {
+    // In texture array mode, a texture index packs the batch slot of the texture array in its upper
+    // 16 bits and the texture's layer within that array in its lower 16 bits. An untextured quad
+    // has a texture index of -1.
+    if (texture == nullptr || texture->isValid() == false) { return -1; }
+
+    RenderData2D& rd = m_renderData2D;
+    Index page = 0;
+    U32 layer = 0;
+    resolveTextureLayer2D(texture, page, layer);
+
+    Index slot = 0;
+    while (slot < rd.batchArrayCount && rd.batchArrays[slot] != page) {
+      ++slot;
+    }
+
+    if (slot == rd.batchArrayCount) {
+      rd.batchArrays[rd.batchArrayCount++] = page;
+    }
+
+    return static_cast<I32>((slot << 16) | layer);
+  }
+
+  void Renderer::resolveTextureLayer2D (const Shared<Texture>& texture, Index& page, U32& layer)
+  {
+    RenderData2D& rd = m_renderData2D;
+    auto iter = rd.arrayEntries.find(texture.get());
+
+    // Entries are keyed by address, so an entry whose texture has since been destroyed may now
+    // belong to a new texture allocated at the same address. A texture whose storage has been
+    // swapped may also no longer fit its entry's page. Either way, the entry's layer may still be
+    // referenced by quads in the batch, so the batch is drawn before the layer is given up.
+    if (
+      iter != rd.arrayEntries.end() && (
+        iter->second.texture.lock() != texture || (
+          iter->second.revision != texture->getRevision() &&
+          rd.arrayPages[iter->second.page].array->isCompatible(*texture) == false
+        )
+      )
+    ) {
+      if (rd.sceneStarted == true && hasPendingQuads2D() == true) {
+        flushScene2D(true, FlushReason2D::TEXTURE_LAYER_RECYCLE);
+      }
+
+      TextureArrayPage2D& oldPage = rd.arrayPages[iter->second.page];
+      oldPage.freeLayers.push_back(iter->second.layer);
+      rd.arrayEntries.erase(iter);
+      iter = rd.arrayEntries.end();
+    }
+
+    if (iter == rd.arrayEntries.end()) {
+      TextureArrayEntry2D entry;
+      entry.texture = texture;
+      entry.revision = texture->getRevision();
+      entry.page = allocateTextureLayer2D(*texture, entry.layer);
+      rd.arrayPages[entry.page].array->copyLayer(entry.layer, *texture);
+      iter = rd.arrayEntries.emplace(texture.get(), entry).first;
+    } else if (iter->second.revision != texture->getRevision()) {
+      rd.arrayPages[iter->second.page].array->copyLayer(iter->second.layer, *texture);
+      iter->second.revision = texture->getRevision();
+    }
+
+    page = iter->second.page;
+    layer = iter->second.layer;
+  }
+
+  Index Renderer::allocateTextureLayer2D (const Texture& texture, U32& layer)
+  {
+    RenderData2D& rd = m_renderData2D;
+
+    // Look for a compatible page with a free layer, first as-is, then after releasing the layers of
+    // destroyed textures. Only then is a compatible page grown, or a new page created.
+    for (Index pass = 0; pass < 2; ++pass) {
+      for (Index i = 0; i < rd.arrayPages.size(); ++i) {
+        TextureArrayPage2D& page = rd.arrayPages[i];
+        if (page.array->isCompatible(texture) == false) { continue; }
+
+        if (page.freeLayers.empty() == false) {
+          layer = page.freeLayers.back();
+          page.freeLayers.pop_back();
+          return i;
+        }
+
+        if (page.usedLayerCount < page.array->getLayerCount()) {
+          layer = page.usedLayerCount++;
+          return i;
+        }
+      }
+
+      if (pass == 0) {
+        sweepTextureLayers2D();
+      }
+    }
+
+    for (Index i = 0; i < rd.arrayPages.size(); ++i) {
+      TextureArrayPage2D& page = rd.arrayPages[i];
+      if (
+        page.array->isCompatible(texture) == true &&
+        page.array->getLayerCount() < RenderData2D::ARRAY_LAYERS_MAX
+      ) {
+        page.array->reserve(
+          std::min(page.array->getLayerCount() * 2, RenderData2D::ARRAY_LAYERS_MAX)
+        );
+        layer = page.usedLayerCount++;
+        return i;
+      }
+    }
+
+    TextureArraySpecification spec;
+    spec.size = texture.getSize();
+    spec.colorChannelCount = texture.getColorChannelCount();
+    spec.layerCount = RenderData2D::ARRAY_LAYERS_INITIAL;
+    spec.wrap = texture.getWrapMode();
+    spec.magnify = texture.getMagnifyFilterMode();
+    spec.minify = texture.getMinifyFilterMode();
+
+    TextureArrayPage2D& page = rd.arrayPages.emplace_back();
+    page.array = TextureArray::make(spec);
+    layer = page.usedLayerCount++;
+    return rd.arrayPages.size() - 1;
+  }
+
+  void Renderer::sweepTextureLayers2D ()
+  {
+    RenderData2D& rd = m_renderData2D;
+    bool anyExpired = std::any_of(rd.arrayEntries.begin(), rd.arrayEntries.end(),
+      [] (const auto& pair) { return pair.second.texture.expired(); });
+    if (anyExpired == false) { return; }
+
+    // As above, the layers being released may still be referenced by quads in the batch.
+    if (rd.sceneStarted == true && hasPendingQuads2D() == true) {
+      flushScene2D(true, FlushReason2D::TEXTURE_LAYER_RECYCLE);
+    }
+
+    for (auto iter = rd.arrayEntries.begin(); iter != rd.arrayEntries.end(); ) {
+      if (iter->second.texture.expired() == true) {
+        rd.arrayPages[iter->second.page].freeLayers.push_back(iter->second.layer);
+        iter = rd.arrayEntries.erase(iter);
+      } else {
+        ++iter;
+      }
+    }
+  }
+
+  void Renderer::slotDeferredShader2D ()
+  {
+    // Deferred quads refer to the shader they were submitted with by its slot in the scene's table
+    // of deferred shaders, which is stored in their sort keys.
+    RenderData2D& rd = m_renderData2D;
+    if (rd.submissionMode != SubmissionMode2D::DEFERRED) { return; }
+
+    const Shared<Shader>& shader = (rd.quadRenderMode == QuadRenderMode2D::INSTANCED) ?
+      rd.instancedQuadShader : rd.quadShader;
+    for (Index i = 0; i < rd.deferredShaders.size(); ++i) {
+      if (rd.deferredShaders[i] == shader) {
+        rd.deferredShaderSlot = static_cast<U8>(i);
+        return;
+      }
+    }
+
+    if (rd.deferredShaders.size() >= RenderData2D::DEFERRED_SHADERS_MAX) {
+      drainQuadCommands2D();
+      return;
+    }
+
+    rd.deferredShaders.push_back(shader);
+    rd.deferredShaderSlot = static_cast<U8>(rd.deferredShaders.size() - 1);
+  }
+
+  void Renderer::sortQuadCommands2D ()
+  {
+    // Least-significant-digit radix sort, one byte of the key per pass. Histograms for all passes
+    // are gathered up front, and a pass is skipped when every key shares that byte. The sort is
+    // stable, so quads with equal keys keep their submission order.
+    RenderData2D& rd = m_renderData2D;
+    Collection<QuadSortEntry2D>& entries = rd.quadSortEntries;
+    Collection<QuadSortEntry2D>& scratch = rd.quadSortScratch;
+    Count entryCount = entries.size();
+    if (entryCount < 2) { return; }
+
+    Count counts[8][256] = {};
+    for (const auto& entry : entries) {
+      for (Index pass = 0; pass < 8; ++pass) {
+        counts[pass][(entry.key >> (pass * 8)) & 0xFF]++;
+      }
+    }
+
+    scratch.resize(entryCount);
+    for (Index pass = 0; pass < 8; ++pass) {
+      U32 shift = pass * 8;
+      if (counts[pass][(entries[0].key >> shift) & 0xFF] == entryCount) { continue; }
+
+      Count offset = 0;
+      for (Index digit = 0; digit < 256; ++digit) {
+        Count count = counts[pass][digit];
+        counts[pass][digit] = offset;
+        offset += count;
+      }
+
+      for (const auto& entry : entries) {
+        scratch[counts[pass][(entry.key >> shift) & 0xFF]++] = entry;
+      }
+
+      entries.swap(scratch);
+    }
+  }
+
+  void Renderer::drainQuadCommands2D ()
+  {
+    RenderData2D& rd = m_renderData2D;
+    mergeQuadRecorders2D();
+    if (rd.quadCommands.empty() == true) { return; }
+
+    sortQuadCommands2D();
+
+    // Quads are expanded in key order. The shader of the active render mode is swapped for each
+    // deferred shader in turn, with the batch flushed in between, then restored.
+    Shared<Shader>& activeShader = (rd.quadRenderMode == QuadRenderMode2D::INSTANCED) ?
+      rd.instancedQuadShader : rd.quadShader;
+    Shared<Shader> currentShader = activeShader;
+
+    for (const auto& entry : rd.quadSortEntries) {
+      const Shared<Shader>& shader = rd.deferredShaders[(entry.key >> 48) & 0xFF];
+      if (shader != activeShader) {
+        if (hasPendingQuads2D() == true) {
+          flushScene2D(true, FlushReason2D::SHADER_CHANGE);
+        }
+
+        activeShader = shader;
+      }
+
+      emitQuad2D(rd.quadCommands[entry.command]);
+    }
+
+    if (activeShader != currentShader) {
+      if (hasPendingQuads2D() == true) {
+        flushScene2D(true, FlushReason2D::SHADER_CHANGE);
+      }
+
+      activeShader = currentShader;
+    }
+
+    rd.quadCommands.clear();
+    rd.quadSortEntries.clear();
+    rd.deferredShaders.clear();
+    rd.deferredShaders.push_back(currentShader);
+    rd.deferredShaderSlot = 0;
+  }
+
+  bool Renderer::hasPendingQuads2D () const
+  {
+    return m_renderData2D.quadVertexCount > 0 || m_renderData2D.multiDrawCommandCount > 0;
+  }
+
+  bool Renderer::isMultiDrawActive2D () const
+  {
+    return m_renderData2D.multiDrawEnabled == true &&
+      m_renderData2D.quadRenderMode == QuadRenderMode2D::BATCHED;
+  }
+
+  void Renderer::closeMultiDraw2D ()
+  {
+    RenderData2D& rd = m_renderData2D;
+
+    // If the batch's textures do not fit alongside those of the draws before it, those draws are
+    // submitted first. The batch's vertices stay where they were written, as the vertex region is
+    // only released once every draw from it has been submitted.
+    if (mapMultiDrawTable2D() == false) {
+      submitMultiDraw2D();
+      mapMultiDrawTable2D();
+    }
+
+    // Each draw's base vertex and base instance are absolute, so they locate the draw's vertices
+    // and texture table within the whole of their buffers rather than the current regions.
+    Count vertexOffset = rd.multiDrawVertexBuffer->getRegionOffset() / sizeof(QuadVertex2D);
+    Count tableOffset = rd.multiDrawTableBuffer->getRegionOffset() /
+      (TEXTURE_SLOT_COUNT * sizeof(I32));
+    DrawIndexedIndirectCommand* commands = rd.multiDrawCommandBuffer->acquireRegion();
+    commands[rd.multiDrawCommandCount] = {
+      static_cast<U32>(rd.quadIndexCount),
+      1,
+      0,
+      static_cast<I32>(vertexOffset + rd.multiDrawVertexStart),
+      static_cast<U32>(tableOffset + rd.multiDrawCommandCount)
+    };
+    rd.multiDrawCommandCount++;
+    rd.multiDrawVertexStart += rd.quadVertexCount;
+    rd.quadVertices = nullptr;
+    rd.stats.uploadSize += rd.quadVertexCount * sizeof(QuadVertex2D) +
+      sizeof(DrawIndexedIndirectCommand) + TEXTURE_SLOT_COUNT * sizeof(I32);
+
+    // The multi-draw is submitted early once its command region is full, and its vertex region is
+    // also released once it has no room left for another full batch.
+    if (
+      rd.multiDrawVertexStart + RenderData2D::VERTICES_PER_BATCH >
+        RenderData2D::MULTI_DRAW_VERTICES_PER_REGION
+    ) {
+      submitMultiDraw2D();
+      releaseMultiDrawRegion2D();
+    } else if (rd.multiDrawCommandCount == RenderData2D::MULTI_DRAW_COMMANDS_PER_REGION) {
+      submitMultiDraw2D();
+    }
+  }
+
+  bool Renderer::mapMultiDrawTable2D ()
+  {
+    // Maps each of the batch's texture slots onto the texture unit of the multi-draw to which its
+    // texture (or texture array page) is bound, adding it to the multi-draw's textures if needed.
+    // The table is written straight into the table region, after those of the draws before it.
+    RenderData2D& rd = m_renderData2D;
+    I32 table[TEXTURE_SLOT_COUNT] = {};
+
+    auto mapSlots = [&] <typename T> (Collection<T>& units, const T* slots, Index first,
+      Count count) {
+      Count unitCount = units.size();
+      for (Index i = first; i < count; ++i) {
+        auto iter = std::find(units.begin(), units.end(), slots[i]);
+        if (iter == units.end()) {
+          if (units.size() >= rd.multiDrawUnitCount) {
+            units.resize(unitCount);
+            return false;
+          }
+
+          iter = units.insert(units.end(), slots[i]);
+        }
+
+        table[i] = static_cast<I32>(iter - units.begin());
+      }
+
+      return true;
+    };
+
+    bool mapped = (rd.textureBindingMode == TextureBindingMode2D::ARRAYS) ?
+      mapSlots(rd.multiDrawPages, rd.batchArrays, 0, rd.batchArrayCount) :
+      mapSlots(rd.multiDrawTextures, rd.textures.data(), 1, rd.batchTextureCount);
+    if (mapped == false) { return false; }
+
+    I32* tables = rd.multiDrawTableBuffer->acquireRegionAs<I32>();
+    std::copy(table, table + TEXTURE_SLOT_COUNT,
+      tables + rd.multiDrawCommandCount * TEXTURE_SLOT_COUNT);
+    return true;
+  }
+
+  void Renderer::submitMultiDraw2D ()
+  {
+    RenderData2D& rd = m_renderData2D;
+    if (rd.multiDrawCommandCount == 0) { return; }
+
+    if (rd.textureBindingMode == TextureBindingMode2D::ARRAYS) {
+      for (Index i = 0; i < rd.multiDrawPages.size(); ++i) {
+        rd.arrayPages[rd.multiDrawPages[i]].array->bind(i);
+      }
+      rd.stats.textureBindCount += rd.multiDrawPages.size();
+    } else {
+      for (Index i = 0; i < rd.multiDrawTextures.size(); ++i) {
+        rd.multiDrawTextures[i]->bind(i);
+      }
+      rd.stats.textureBindCount += rd.multiDrawTextures.size();
+    }
+
+    if (rd.gpuTimer != nullptr) { rd.gpuTimer->beginRange(); }
+    rd.quadShader->bind();
+    rd.multiDrawTableBuffer->bind(0);
+    RenderCommand::multiDrawIndexedIndirect(rd.multiDrawVertexArray, rd.multiDrawCommandBuffer,
+      rd.multiDrawCommandCount, rd.multiDrawCommandBuffer->getRegionFirstCommand());
+    if (rd.gpuTimer != nullptr) { rd.gpuTimer->endRange(); }
+    rd.stats.multiDrawCount++;
+
+    // The command and table regions are fenced against the multi-draw which read them. The vertex
+    // region may still have room for more batches, so it is released separately.
+    rd.multiDrawCommandBuffer->releaseRegion();
+    rd.multiDrawTableBuffer->releaseRegion();
+    rd.multiDrawCommandCount = 0;
+    rd.multiDrawTextures.clear();
+    rd.multiDrawPages.clear();
+  }
+
+  void Renderer::releaseMultiDrawRegion2D ()
+  {
+    RenderData2D& rd = m_renderData2D;
+    if (rd.multiDrawVertexBuffer->isRegionAcquired() == true) {
+      rd.multiDrawVertexBuffer->releaseRegion();
+    }
+
+    rd.multiDrawVertexStart = 0;
+  }
+
 }
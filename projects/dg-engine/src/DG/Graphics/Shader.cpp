@@ -0,0 +1,34 @@
+/** @file DG/Graphics/Shader.cpp */
+
+#include <DG/Graphics/Shader.hpp>
+
+namespace dg
+{
+
+  Shared<Shader> Shader::make (const ShaderSpecification& spec)
+  {
+    // Share the permutation if it is still held by another user.
+    String key = ShaderPreprocessor::getPermutationKey(spec.path, spec.defines);
+    if (auto iter = s_permutations.find(key); iter != s_permutations.end()) {
+      if (Shared<Shader> shader = iter->second.lock(); shader != nullptr) {
+        if (spec.async == false) { shader->wait(); }
+        return shader;
+      }
+    }
+
+    std::erase_if(s_permutations, [] (const auto& entry) { return entry.second.expired(); });
+
+    Shared<Shader> shader = makePermutation(spec.path, spec.defines, spec.async);
+    s_permutations[key] = shader;
+    return shader;
+  }
+
+  void Shader::pollPending ()
+  {
+    std::erase_if(s_pendingShaders, [] (const Weak<Shader>& pending) {
+      Shared<Shader> shader = pending.lock();
+      return shader == nullptr || shader->poll() == true;
+    });
+  }
+
+}
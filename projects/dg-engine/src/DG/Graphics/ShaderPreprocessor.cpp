@@ -0,0 +1,459 @@
+/** @file DG/Graphics/ShaderPreprocessor.cpp */
+
+#include <DG/Core/FileIo.hpp>
+#include <DG/Graphics/RenderCommand.hpp>
+#include <DG/Graphics/Texture.hpp>
+#include <DG/Graphics/ShaderPreprocessor.hpp>
+
+namespace dg
+{
+
+  static StringView trimDirective (StringView line)
+  {
+    Index begin = line.find_first_not_of(" \t");
+    return (begin == StringView::npos) ? StringView {} : line.substr(begin);
+  }
+
+  struct ShaderConditional
+  {
+    bool parentActive = true;
+    bool active = true;
+    bool taken = true;
+  };
+
+  struct ShaderStageState
+  {
+    String* code = nullptr;
+    Collection<Path>* sourceFiles = nullptr;
+    Set<String> includedFiles {};
+    Dictionary<String> macros {};
+    Collection<ShaderConditional> conditionals {};
+    Index startLine = 1;
+    bool hasVersion = false;
+  };
+
+  // Evaluates the expression of an #if or #elif directive. Only what the engine's shaders need is
+  // supported: `defined(NAME)` or `defined NAME`, one comparison of two integers, each a literal or
+  // a macro whose value is one, and `!`, `&&`, `||` and parentheses over those.
+  struct ShaderExpression
+  {
+    static constexpr Count MAX_MACRO_DEPTH = 16;
+
+    StringView text;
+    const Dictionary<String>& macros;
+    Index position = 0;
+
+    bool accept (StringView token)
+    {
+      Index begin = text.find_first_not_of(" \t", position);
+      if (begin == StringView::npos || text.substr(begin).starts_with(token) == false) {
+        return false;
+      }
+
+      position = begin + token.size();
+      return true;
+    }
+
+    bool readName (StringView& name)
+    {
+      Index begin = text.find_first_not_of(" \t", position);
+      if (begin == StringView::npos) { return false; }
+
+      Index end = begin;
+      while (end < text.size() && (std::isalnum(static_cast<U8>(text[end])) != 0 ||
+        text[end] == '_')) {
+        ++end;
+      }
+
+      name = text.substr(begin, end - begin);
+      position = end;
+      return name.empty() == false;
+    }
+
+    bool readInteger (I64& value)
+    {
+      StringView name;
+      if (readName(name) == false) { return false; }
+
+      // A macro may be defined as another macro. A name which is not a macro evaluates to zero, as
+      // in the C preprocessor.
+      for (Count depth = 0; std::isdigit(static_cast<U8>(name.front())) == 0; ++depth) {
+        auto iter = macros.find(String { name });
+        if (iter == macros.end()) { value = 0; return true; }
+
+        name = trimDirective(iter->second);
+        if (name.empty() == true || depth == MAX_MACRO_DEPTH) { return false; }
+      }
+
+      auto [end, error] = std::from_chars(name.data(), name.data() + name.size(), value);
+      return error == std::errc {} && end == name.data() + name.size();
+    }
+
+    bool parseTerm (bool& value)
+    {
+      if (accept("!")) {
+        if (parseTerm(value) == false) { return false; }
+        value = !value;
+        return true;
+      } else if (accept("(")) {
+        return parseOr(value) && accept(")");
+      }
+
+      Index start = position;
+      StringView name;
+      if (readName(name) == true && name == "defined") {
+        bool parenthesized = accept("(");
+        if (readName(name) == false) { return false; }
+        if (parenthesized == true && accept(")") == false) { return false; }
+
+        value = macros.contains(String { name });
+        return true;
+      }
+
+      position = start;
+      I64 lhs = 0, rhs = 0;
+      if (readInteger(lhs) == false) { return false; }
+
+      static constexpr StringView COMPARISONS[] = { "==", "!=", "<=", ">=", "<", ">" };
+      for (StringView comparison : COMPARISONS) {
+        if (accept(comparison) == false) { continue; }
+        if (readInteger(rhs) == false) { return false; }
+
+        if      (comparison == "==") { value = (lhs == rhs); }
+        else if (comparison == "!=") { value = (lhs != rhs); }
+        else if (comparison == "<=") { value = (lhs <= rhs); }
+        else if (comparison == ">=") { value = (lhs >= rhs); }
+        else if (comparison == "<")  { value = (lhs < rhs); }
+        else                         { value = (lhs > rhs); }
+        return true;
+      }
+
+      value = (lhs != 0);
+      return true;
+    }
+
+    bool parseAnd (bool& value)
+    {
+      if (parseTerm(value) == false) { return false; }
+      while (accept("&&")) {
+        bool rhs = false;
+        if (parseTerm(rhs) == false) { return false; }
+        value = value && rhs;
+      }
+
+      return true;
+    }
+
+    bool parseOr (bool& value)
+    {
+      if (parseAnd(value) == false) { return false; }
+      while (accept("||")) {
+        bool rhs = false;
+        if (parseAnd(rhs) == false) { return false; }
+        value = value || rhs;
+      }
+
+      return true;
+    }
+
+    bool parse (bool& value)
+    {
+      return parseOr(value) && text.find_first_not_of(" \t", position) == StringView::npos;
+    }
+  };
+
+  static String makeDefineBlock (const ShaderDefines& defines)
+  {
+    String block = "";
+    for (const auto& define : defines) {
+      Index separator = define.find('=');
+      block += "#define ";
+      if (separator == String::npos) {
+        block += define;
+      } else {
+        block += define.substr(0, separator);
+        block += " ";
+        block += define.substr(separator + 1);
+      }
+
+      block += "\n";
+    }
+
+    return block;
+  }
+
+  static void addDefineMacros (const ShaderDefines& defines, ShaderStageState& stage)
+  {
+    for (const auto& define : defines) {
+      Index separator = define.find('=');
+      if (separator == String::npos) {
+        stage.macros[define] = "";
+      } else {
+        stage.macros[define.substr(0, separator)] = define.substr(separator + 1);
+      }
+    }
+  }
+
+  // Splits a preprocessor directive into its name, such as "ifdef", and the rest of its line.
+  static bool splitDirective (StringView directive, StringView& name, StringView& rest)
+  {
+    if (directive.starts_with("#") == false) { return false; }
+
+    directive = trimDirective(directive.substr(1));
+    Index end = directive.find_first_of(" \t(");
+    name = directive.substr(0, end);
+    rest = (end == StringView::npos) ? StringView {} : trimDirective(directive.substr(end));
+
+    // Trailing line comments are not part of the directive.
+    Index comment = rest.find("//");
+    if (comment != StringView::npos) { rest = rest.substr(0, comment); }
+    while (rest.empty() == false && std::isspace(static_cast<U8>(rest.back())) != 0) {
+      rest.remove_suffix(1);
+    }
+
+    return true;
+  }
+
+  static bool isActive (const ShaderStageState& stage)
+  {
+    return stage.conditionals.empty() == true || stage.conditionals.back().active == true;
+  }
+
+  // Tracks the conditional blocks of a stage, so that includes and defines are only processed
+  // where the GLSL preprocessor will keep them. Returns false if the line is a conditional
+  // directive which cannot be processed.
+  static bool processConditional (StringView name, StringView rest, ShaderStageState& stage,
+    bool& isConditional)
+  {
+    isConditional = true;
+    if (name == "if" || name == "ifdef" || name == "ifndef") {
+      ShaderConditional conditional { isActive(stage), false, false };
+      if (conditional.parentActive == true) {
+        if (name == "if") {
+          ShaderExpression expression { rest, stage.macros };
+          if (expression.parse(conditional.active) == false) {
+            DG_ENGINE_ERROR("Unsupported #if expression '{}'.", rest);
+            return false;
+          }
+        } else {
+          conditional.active = (stage.macros.contains(String { rest }) == (name == "ifdef"));
+        }
+      }
+
+      conditional.taken = conditional.active;
+      stage.conditionals.push_back(conditional);
+    } else if (name == "elif" || name == "else" || name == "endif") {
+      if (stage.conditionals.empty() == true) {
+        DG_ENGINE_ERROR("#{} directive without a matching #if.", name);
+        return false;
+      }
+
+      ShaderConditional& conditional = stage.conditionals.back();
+      if (name == "endif") {
+        stage.conditionals.pop_back();
+      } else if (conditional.parentActive == false || conditional.taken == true) {
+        conditional.active = false;
+      } else if (name == "else") {
+        conditional.active = true;
+        conditional.taken = true;
+      } else {
+        ShaderExpression expression { rest, stage.macros };
+        if (expression.parse(conditional.active) == false) {
+          DG_ENGINE_ERROR("Unsupported #elif expression '{}'.", rest);
+          return false;
+        }
+
+        conditional.taken = conditional.active;
+      }
+    } else {
+      isConditional = false;
+    }
+
+    return true;
+  }
+
+  // Returns the source string number of the given file in the #line directives of every stage.
+  static Index getSourceIndex (const Path& path, ShaderStageState& stage)
+  {
+    Collection<Path>& files = *stage.sourceFiles;
+    auto iter = std::find(files.begin(), files.end(), path);
+    if (iter != files.end()) { return iter - files.begin(); }
+
+    files.push_back(path);
+    return files.size() - 1;
+  }
+
+  // Makes the GLSL compiler number the following line as the given line of the given file.
+  static String makeLineDirective (const Index line, const Index sourceIndex)
+  {
+    return "#line " + std::to_string(line) + " " + std::to_string(sourceIndex) + "\n";
+  }
+
+  static bool processLine (const Path& path, StringView line, const Index number,
+    const String& defineBlock, ShaderStageState& stage);
+
+  static bool includeFile (const Path& path, const String& defineBlock, ShaderStageState& stage)
+  {
+    // Each file is only included once per stage, which also stops include cycles.
+    String key = FileIo::getAbsolute(path).string();
+    if (stage.includedFiles.contains(key) == true) { return true; }
+    stage.includedFiles.insert(key);
+
+    *stage.code += makeLineDirective(1, getSourceIndex(path, stage));
+    bool result = FileIo::loadTextFile(
+      path,
+      [&] (StringView line, Index number)
+      {
+        if (trimDirective(line).starts_with("#shader")) {
+          DG_ENGINE_ERROR("Invalid #shader directive in included file.");
+          return false;
+        }
+
+        return processLine(path, line, number, defineBlock, stage);
+      }
+    );
+
+    if (result == false) {
+      DG_ENGINE_ERROR("Could not include GLSL shader file '{}'.", path);
+    }
+
+    return result;
+  }
+
+  static bool processLine (const Path& path, StringView line, const Index number,
+    const String& defineBlock, ShaderStageState& stage)
+  {
+    StringView directive = trimDirective(line);
+    StringView name, rest;
+    if (splitDirective(directive, name, rest) == true) {
+      bool isConditional = false;
+      if (processConditional(name, rest, stage, isConditional) == false) { return false; }
+
+      if (isConditional == false && isActive(stage) == true) {
+        if (name == "include") {
+          Index open = rest.find_first_of("\"<");
+          Index close = (open == StringView::npos) ? StringView::npos :
+            rest.find_first_of("\">", open + 1);
+          if (close == StringView::npos || close == open + 1) {
+            DG_ENGINE_ERROR("Invalid #include directive.");
+            return false;
+          }
+
+          // The lines after the include are numbered as this file's again.
+          Path includePath = path.parent_path() / rest.substr(open + 1, close - open - 1);
+          if (includeFile(includePath, defineBlock, stage) == false) { return false; }
+
+          *stage.code += makeLineDirective(number + 1, getSourceIndex(path, stage));
+          return true;
+        } else if (name == "define" || name == "undef") {
+          Index end = rest.find_first_of(" \t(");
+          String macro { rest.substr(0, end) };
+          if (name == "undef") {
+            stage.macros.erase(macro);
+          } else {
+            stage.macros[macro] = (end == StringView::npos) ? "" :
+              String { trimDirective(rest.substr(end)) };
+          }
+        }
+      } else if (name == "include") {
+        // Includes in inactive blocks are blanked out, and do not count as included.
+        *stage.code += "\n";
+        return true;
+      }
+    }
+
+    *stage.code += line;
+    *stage.code += "\n";
+
+    // The defines must follow the stage's version directive, which has to come first.
+    if (stage.hasVersion == false && directive.starts_with("#version")) {
+      *stage.code += defineBlock;
+      *stage.code += makeLineDirective(number + 1, getSourceIndex(path, stage));
+      stage.hasVersion = true;
+    }
+
+    return true;
+  }
+
+  bool ShaderPreprocessor::load (const Path& path, const ShaderDefines& defines,
+    ShaderSource& source)
+  {
+    source = {};
+
+    // Shaders also get the engine's texture limits, to size their sampler arrays by.
+    ShaderDefines allDefines = defines;
+    allDefines.push_back("DG_TEXTURE_SLOT_COUNT=" + std::to_string(TEXTURE_SLOT_COUNT));
+    allDefines.push_back("DG_FRAGMENT_TEXTURE_UNITS=" +
+      std::to_string(RenderCommand::getTextureUnitCount()));
+
+    String defineBlock = makeDefineBlock(allDefines);
+    ShaderStageState vertexStage;
+    ShaderStageState fragmentStage;
+    vertexStage.code = &source.vertexCode;
+    fragmentStage.code = &source.fragmentCode;
+    vertexStage.sourceFiles = &source.sourceFiles;
+    fragmentStage.sourceFiles = &source.sourceFiles;
+    source.sourceFiles.push_back(path);
+    addDefineMacros(allDefines, vertexStage);
+    addDefineMacros(allDefines, fragmentStage);
+    ShaderStageState* stage = nullptr;
+
+    bool result = FileIo::loadTextFile(
+      path,
+      [&] (StringView line, Index number)
+      {
+        StringView directive = trimDirective(line);
+        if (directive.starts_with("#shader ")) {
+          if (directive.ends_with("vertex")) { stage = &vertexStage; }
+          else if (directive.ends_with("fragment")) { stage = &fragmentStage; }
+          else {
+            DG_ENGINE_ERROR("Invalid #shader directive.");
+            return false;
+          }
+
+          if (stage->code->empty() == true) { stage->startLine = number + 1; }
+        } else if (stage == nullptr) {
+          DG_ENGINE_ERROR("No #shader directive set.");
+          return false;
+        } else {
+          return processLine(path, line, number, defineBlock, *stage);
+        }
+
+        return true;
+      }
+    );
+
+    if (result == false) { return false; }
+
+    for (ShaderStageState* state : { &vertexStage, &fragmentStage }) {
+      if (state->conditionals.empty() == false) {
+        DG_ENGINE_ERROR("Unterminated #if block in shader file '{}'.", path);
+        return false;
+      }
+    }
+
+    // A stage without a version directive gets its defines at the very top.
+    for (ShaderStageState* state : { &vertexStage, &fragmentStage }) {
+      if (state->hasVersion == false && state->code->empty() == false) {
+        state->code->insert(0, defineBlock + makeLineDirective(state->startLine, 0));
+      }
+    }
+
+    return true;
+  }
+
+  String ShaderPreprocessor::getPermutationKey (const Path& path, const ShaderDefines& defines)
+  {
+    ShaderDefines sortedDefines = defines;
+    std::sort(sortedDefines.begin(), sortedDefines.end());
+
+    String key = FileIo::getAbsolute(path).string();
+    for (const auto& define : sortedDefines) {
+      key += "|";
+      key += define;
+    }
+
+    return key;
+  }
+
+}
@@ -40,6 +40,7 @@ namespace dg
     }
 
     m_valid = onImageDataLoaded(data);
+    m_revision++;
     if (m_valid == false) {
       DG_ENGINE_ERROR("Could not load image file '{}' - Error parsing image data.", path);
     }
@@ -48,5 +49,16 @@ namespace dg
     return m_valid;
   }
 
+  void Texture::swapProperties (Texture& other)
+  {
+    std::swap(m_valid, other.m_valid);
+    std::swap(m_size, other.m_size);
+    std::swap(m_colorChannelCount, other.m_colorChannelCount);
+    std::swap(m_wrap, other.m_wrap);
+    std::swap(m_magnify, other.m_magnify);
+    std::swap(m_minify, other.m_minify);
+    m_revision++;
+    other.m_revision++;
+  }
 
 }
@@ -0,0 +1,208 @@
+/** @file DG/Graphics/TextureAtlas.cpp */
+
+#if defined(__GNUC__)
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wunused-function"
+#endif
+
+#define STBRP_STATIC
+#define STB_RECT_PACK_IMPLEMENTATION
+#include <imstb_rectpack.h>
+
+#if defined(__GNUC__)
+  #pragma GCC diagnostic pop
+#endif
+
+#include <stb_image.h>
+
+#include <DG/Graphics/TextureAtlas.hpp>
+
+namespace dg
+{
+
+  struct TextureAtlasPage
+  {
+    Shared<Texture> texture = nullptr;
+    stbrp_context context;
+    Collection<stbrp_node> nodes;
+  };
+
+  TextureAtlas::TextureAtlas (const TextureAtlasSpecification& spec) :
+    m_pageSize { spec.pageSize },
+    m_padding { spec.padding },
+    m_extrude { spec.extrude },
+    m_magnify { spec.magnify },
+    m_minify { spec.minify }
+  {
+    if (m_pageSize.x <= 0 || m_pageSize.y <= 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to create texture atlas with zero page size!");
+    }
+
+    if (m_padding < 0 || m_extrude < 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to create texture atlas with negative padding or extrusion!");
+    }
+  }
+
+  TextureAtlas::~TextureAtlas ()
+  {
+    clear();
+  }
+
+  Unique<TextureAtlas> TextureAtlas::make (const TextureAtlasSpecification& spec)
+  {
+    return std::make_unique<TextureAtlas>(spec);
+  }
+
+  SubTexture TextureAtlas::insert (const void* data, const Vector2i& size,
+    const I32 colorChannelCount)
+  {
+    if (data == nullptr || size.x <= 0 || size.y <= 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to insert null or zero-sized image into texture atlas!");
+    }
+
+    if (colorChannelCount < 1 || colorChannelCount > 4) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to insert image with invalid color channel count {} into texture atlas!",
+          colorChannelCount);
+    }
+
+    I32 border = m_padding + m_extrude;
+    Vector2i packedSize = { size.x + border * 2, size.y + border * 2 };
+    if (packedSize.x > m_pageSize.x || packedSize.y > m_pageSize.y) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to insert {}x{} image into texture atlas with {}x{} pages!", size.x, size.y,
+          m_pageSize.x, m_pageSize.y);
+    }
+
+    // Find room for the image, with its border, on the first page which has it.
+    stbrp_rect rect {};
+    rect.w = packedSize.x;
+    rect.h = packedSize.y;
+
+    TextureAtlasPage* page = nullptr;
+    for (const auto& candidate : m_pages) {
+      if (stbrp_pack_rects(&candidate->context, &rect, 1) == 1) {
+        page = candidate.get();
+        break;
+      }
+    }
+
+    if (page == nullptr) {
+      page = m_pages.emplace_back(std::make_unique<TextureAtlasPage>()).get();
+      page->texture = Texture::make(TextureSpecification {
+        .size = m_pageSize,
+        .colorChannelCount = 4,
+        .wrap = TextureWrapMode::CLAMP_TO_EDGE,
+        .magnify = m_magnify,
+        .minify = m_minify
+      });
+      page->nodes.resize(m_pageSize.x);
+      stbrp_init_target(&page->context, m_pageSize.x, m_pageSize.y, page->nodes.data(),
+        static_cast<int>(page->nodes.size()));
+      stbrp_pack_rects(&page->context, &rect, 1);
+    }
+
+    // Expand the image to RGBA, then extrude its edges outwards. The padding around the extruded
+    // image stays transparent, and is uploaded along with it, so the page never needs clearing.
+    const U8* source = static_cast<const U8*>(data);
+    Collection<U8> pixels(packedSize.x * packedSize.y * 4, 0);
+    auto pixelAt = [&] (I32 x, I32 y) { return &pixels[(y * packedSize.x + x) * 4]; };
+
+    for (I32 y = 0; y < size.y; ++y) {
+      for (I32 x = 0; x < size.x; ++x) {
+        const U8* texel = &source[(y * size.x + x) * colorChannelCount];
+        U8* pixel = pixelAt(x + border, y + border);
+        switch (colorChannelCount) {
+          case 1: pixel[0] = pixel[1] = pixel[2] = texel[0]; pixel[3] = 0xFF; break;
+          case 2: pixel[0] = pixel[1] = pixel[2] = texel[0]; pixel[3] = texel[1]; break;
+          case 3: std::memcpy(pixel, texel, 3); pixel[3] = 0xFF; break;
+          default: std::memcpy(pixel, texel, 4); break;
+        }
+      }
+    }
+
+    for (I32 y = border; y < border + size.y; ++y) {
+      for (I32 e = 1; e <= m_extrude; ++e) {
+        std::memcpy(pixelAt(border - e, y), pixelAt(border, y), 4);
+        std::memcpy(pixelAt(border + size.x - 1 + e, y), pixelAt(border + size.x - 1, y), 4);
+      }
+    }
+
+    Size extrudedRowSize = (size.x + m_extrude * 2) * 4;
+    for (I32 e = 1; e <= m_extrude; ++e) {
+      std::memcpy(pixelAt(m_padding, border - e), pixelAt(m_padding, border),
+        extrudedRowSize);
+      std::memcpy(pixelAt(m_padding, border + size.y - 1 + e),
+        pixelAt(m_padding, border + size.y - 1), extrudedRowSize);
+    }
+
+    page->texture->uploadRegion({ rect.x, rect.y }, packedSize, pixels.data(), pixels.size());
+
+    SubTexture subTexture;
+    subTexture.texture = page->texture;
+    subTexture.size = size;
+    subTexture.texRect = {
+      static_cast<F32>(rect.x + border) / m_pageSize.x,
+      static_cast<F32>(rect.y + border) / m_pageSize.y,
+      static_cast<F32>(rect.x + border + size.x) / m_pageSize.x,
+      static_cast<F32>(rect.y + border + size.y) / m_pageSize.y
+    };
+
+    return subTexture;
+  }
+
+  SubTexture TextureAtlas::insert (const Path& path)
+  {
+    String key = path.string();
+    if (auto iter = m_pathSubTextures.find(key); iter != m_pathSubTextures.end()) {
+      return iter->second;
+    }
+
+    if (fs::exists(path) == false) {
+      DG_ENGINE_ERROR("Image filename '{}' not found.", path);
+      return {};
+    }
+
+    Vector2i size;
+    I32 colorChannelCount = 0;
+    stbi_set_flip_vertically_on_load(true);
+    stbi_uc* data = stbi_load(path.c_str(), &size.x, &size.y, &colorChannelCount, 0);
+    if (data == nullptr) {
+      DG_ENGINE_ERROR("Could not load image file '{}' - {}", path,
+        stbi_failure_reason());
+      return {};
+    }
+
+    SubTexture subTexture = insert(data, size, colorChannelCount);
+    stbi_image_free(data);
+
+    m_pathSubTextures[key] = subTexture;
+    return subTexture;
+  }
+
+  SubTexture TextureAtlas::find (const Path& path) const
+  {
+    auto iter = m_pathSubTextures.find(path.string());
+    return (iter != m_pathSubTextures.end()) ? iter->second : SubTexture {};
+  }
+
+  void TextureAtlas::clear ()
+  {
+    m_pathSubTextures.clear();
+    m_pages.clear();
+  }
+
+  Shared<Texture> TextureAtlas::getPage (const Index index) const
+  {
+    if (index >= m_pages.size()) {
+      DG_ENGINE_THROW(std::out_of_range,
+        "Attempt to get out of range texture atlas page {}!", index);
+    }
+
+    return m_pages[index]->texture;
+  }
+
+}
@@ -0,0 +1,147 @@
+/** @file DG/Graphics/TextureLoader.cpp */
+
+#include <stb_image.h>
+
+#include <DG/Graphics/TextureLoader.hpp>
+
+namespace dg
+{
+
+  struct TextureLoadRequest
+  {
+    Path path;
+    TextureSpecification spec;
+    Weak<Texture> texture;
+    Shared<Texture> staging = nullptr;
+    UniqueWithFree<U8> pixels { nullptr, stbi_image_free };
+    I32 uploadedRows = 0;
+    std::atomic<bool> decoded = false;
+  };
+
+  TextureLoader::TextureLoader (ThreadPool& threadPool, const TextureLoaderSpecification& spec) :
+    m_threadPool { threadPool },
+    m_uploadBudget { spec.uploadBudget }
+  {
+    if (spec.uploadBudget == 0 || spec.regionCount == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to create texture loader with zero upload budget or region count!");
+    }
+
+    m_uploadBuffer = PixelUploadBuffer::make(spec.uploadBudget, spec.regionCount);
+  }
+
+  TextureLoader::~TextureLoader ()
+  {
+    // Decoding tasks still in flight only hold onto their own requests, so they are left to finish
+    // on their own.
+    if (m_uploadBuffer->isRegionAcquired() == true) {
+      m_uploadBuffer->releaseRegion();
+    }
+  }
+
+  Unique<TextureLoader> TextureLoader::make (ThreadPool& threadPool,
+    const TextureLoaderSpecification& spec)
+  {
+    return std::make_unique<TextureLoader>(threadPool, spec);
+  }
+
+  Shared<Texture> TextureLoader::load (const Path& path, const TextureSpecification& spec)
+  {
+    TextureSpecification placeholderSpec = spec;
+    placeholderSpec.size = { 1, 1 };
+    placeholderSpec.colorChannelCount = 4;
+
+    U32 whiteTexel = 0xFFFFFFFF;
+    Shared<Texture> texture = Texture::make(placeholderSpec);
+    texture->upload(&whiteTexel, sizeof(U32));
+
+    auto request = std::make_shared<TextureLoadRequest>();
+    request->path = path;
+    request->spec = spec;
+    request->texture = texture;
+    m_requests.push_back(request);
+
+    m_threadPool.submit([request] {
+      Vector2i& size = request->spec.size;
+      I32& colorChannelCount = request->spec.colorChannelCount;
+
+      stbi_set_flip_vertically_on_load_thread(true);
+      request->pixels.reset(stbi_load(request->path.c_str(), &size.x, &size.y,
+        &colorChannelCount, 0));
+      if (request->pixels == nullptr) {
+        DG_ENGINE_ERROR("Could not load image file '{}' - {}", request->path,
+          stbi_failure_reason());
+      }
+
+      request->decoded = true;
+      request->decoded.notify_one();
+    });
+
+    return texture;
+  }
+
+  void TextureLoader::update ()
+  {
+    Size budgetUsed = 0;
+
+    // Requests are finished in the order they were made, so that the first textures requested are
+    // the first to appear.
+    for (auto iter = m_requests.begin(); iter != m_requests.end();) {
+      TextureLoadRequest& request = **iter;
+      if (request.decoded == false) { ++iter; continue; }
+
+      Shared<Texture> texture = request.texture.lock();
+      if (texture == nullptr || request.pixels == nullptr) {
+        iter = m_requests.erase(iter);
+        continue;
+      }
+
+      if (request.staging == nullptr) {
+        request.staging = Texture::make(request.spec);
+      }
+
+      // Stream as many whole rows as are left in this update's budget. A row too large for the
+      // whole budget is uploaded straight from client memory instead, so that it is not stuck.
+      const Vector2i& size = request.spec.size;
+      Size rowSize = size.x * request.spec.colorChannelCount;
+      const U8* rows = request.pixels.get() + request.uploadedRows * rowSize;
+
+      if (rowSize > m_uploadBudget) {
+        if (budgetUsed > 0) { break; }
+
+        request.staging->uploadRegion({ 0, request.uploadedRows }, { size.x, 1 }, rows, rowSize);
+        request.uploadedRows++;
+        budgetUsed = m_uploadBudget;
+      } else {
+        I32 rowCount = std::min<I32>(size.y - request.uploadedRows,
+          (m_uploadBudget - budgetUsed) / rowSize);
+        if (rowCount == 0) { break; }
+
+        U8* region = static_cast<U8*>(m_uploadBuffer->acquireRegion());
+        std::memcpy(region + budgetUsed, rows, rowCount * rowSize);
+        request.staging->uploadRegion({ 0, request.uploadedRows }, { size.x, rowCount },
+          *m_uploadBuffer, budgetUsed);
+        request.uploadedRows += rowCount;
+        budgetUsed += rowCount * rowSize;
+      }
+
+      if (request.uploadedRows < size.y) { break; }
+
+      texture->swapStorage(*request.staging);
+      iter = m_requests.erase(iter);
+    }
+
+    if (m_uploadBuffer->isRegionAcquired() == true) {
+      m_uploadBuffer->releaseRegion();
+    }
+  }
+
+  void TextureLoader::finish ()
+  {
+    while (m_requests.empty() == false) {
+      m_requests.front()->decoded.wait(false);
+      update();
+    }
+  }
+
+}
@@ -10,11 +10,13 @@ namespace dg
   VertexAttribute::VertexAttribute (
     const String& name,
     const VertexAttributeType type,
-    bool normalized
+    bool normalized,
+    U32 divisor
   ) :
     name { name },
     type { type },
     normalized { normalized },
+    divisor { divisor },
     offset { 0 }
   {
 
@@ -47,6 +49,9 @@ namespace dg
       case VertexAttributeType::Double3x3: return 8 * 3 * 3;      
       case VertexAttributeType::Float4x4:  return 4 * 4 * 4;      
       case VertexAttributeType::Double4x4: return 8 * 4 * 4;       
+      case VertexAttributeType::Ushort2:   return 2 * 2;
+      case VertexAttributeType::Ushort4:   return 2 * 4;
+      case VertexAttributeType::Ubyte4:    return 1 * 4;
       default:                             return 0;
     }
   }
@@ -78,10 +83,35 @@ namespace dg
       case VertexAttributeType::Double3x3: return 3 * 3;               
       case VertexAttributeType::Float4x4:  return 4 * 4;               
       case VertexAttributeType::Double4x4: return 4 * 4;           
+      case VertexAttributeType::Ushort2:   return 2;
+      case VertexAttributeType::Ushort4:   return 4;
+      case VertexAttributeType::Ubyte4:    return 4;
       default: return 0;     
     }
   }
 
+  bool VertexAttribute::isInteger () const
+  {
+    if (normalized == true) { return false; }
+
+    switch (type) {
+      case VertexAttributeType::Int:
+      case VertexAttributeType::Uint:
+      case VertexAttributeType::Int2:
+      case VertexAttributeType::Uint2:
+      case VertexAttributeType::Int3:
+      case VertexAttributeType::Uint3:
+      case VertexAttributeType::Int4:
+      case VertexAttributeType::Uint4:
+      case VertexAttributeType::Ushort2:
+      case VertexAttributeType::Ushort4:
+      case VertexAttributeType::Ubyte4:
+        return true;
+
+      default: return false;
+    }
+  }
+
   /** Vertex Layout Class *************************************************************************/
 
   VertexLayout::VertexLayout (const InitList<VertexAttribute>& attributes) :
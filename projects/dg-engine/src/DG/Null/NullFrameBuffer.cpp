@@ -0,0 +1,155 @@
+/** @file DG/Null/NullFrameBuffer.cpp */
+
+#include <DG/Graphics/RenderCommand.hpp>
+#include <DG/Null/NullRecorder.hpp>
+#include <DG/Null/NullFrameBuffer.hpp>
+
+namespace dg
+{
+
+  Shared<FrameBuffer> FrameBuffer::make (const FrameBufferSpecification& spec)
+  {
+    return std::make_shared<Null::FrameBufferImpl>(spec);
+  }
+
+}
+
+namespace dg::Null
+{
+
+  FrameBufferImpl::FrameBufferImpl (const FrameBufferSpecification& spec) :
+    FrameBuffer { spec }
+  {
+    for (const auto& attachment : m_spec.attachmentSpec.attachments) {
+      if (attachment.isDepthTextureFormat() == true) {
+        m_depthAttachmentSpec = attachment;
+      } else {
+        m_colorAttachmentSpecs.push_back(attachment);
+      }
+    }
+
+    build();
+  }
+
+  void FrameBufferImpl::bind (FrameBufferBindTarget target) const
+  {
+    Recorder::record(CommandType::BIND_FRAMEBUFFER, m_handle, static_cast<I64>(target));
+
+    if (
+      target == FrameBufferBindTarget::DRAW ||
+      target == FrameBufferBindTarget::BOTH
+    ) {
+      Vector2u renderSize = getRenderSize();
+      RenderCommand::setViewport(renderSize.x, renderSize.y);
+      RenderCommand::clear();
+    }
+  }
+
+  void FrameBufferImpl::unbind (FrameBufferBindTarget target) const
+  {
+    Recorder::record(CommandType::UNBIND_FRAMEBUFFER, m_handle, static_cast<I64>(target));
+  }
+
+  U32 FrameBufferImpl::getColorHandle (const Index index) const
+  {
+    if (index >= m_colorHandles.size()) {
+      DG_ENGINE_THROW(std::out_of_range,
+        "Attempt to get framebuffer color attachment at out of range index {}!", index);
+    }
+
+    return m_colorHandles.at(index);
+  }
+
+  U32 FrameBufferImpl::getDepthHandle () const
+  {
+    return m_depthHandle;
+  }
+
+  void* FrameBufferImpl::getColorPointer (const Index index) const
+  {
+    if (index >= m_colorHandles.size()) {
+      DG_ENGINE_THROW(std::out_of_range,
+        "Attempt to point to framebuffer color attachment at out of range index {}!", index);
+    }
+
+    return (void*) (intptr_t) m_colorHandles.at(index);
+  }
+
+  I32 FrameBufferImpl::readPixelI32 (const Index index, const Vector2i& position) const
+  {
+    if (index >= m_colorHandles.size()) {
+      DG_ENGINE_THROW(std::out_of_range,
+        "Attempt to read pixel data from framebuffer color attachment at out of range index {}!", 
+          index);
+    }
+
+    if (position.x < 0 || position.y < 0 ||
+      static_cast<U32>(position.x) >= m_spec.size.x ||
+      static_cast<U32>(position.y) >= m_spec.size.y) {
+      return -1;
+    }
+
+    // Nothing was ever drawn, so every pixel reads as cleared, which in an entity ID attachment
+    // means no entity.
+    Vector2i renderPosition = getRenderPosition(position);
+    Recorder::record(CommandType::READ_PIXELS, m_handle, index, renderPosition.x,
+      renderPosition.y, 0, sizeof(I32));
+    return -1;
+  }
+
+  I32 FrameBufferImpl::readPixelI32 (const Index index, const Vector2f& position) const
+  {
+    return readPixelI32(index, position.cast<I32>());
+  }
+
+  bool FrameBufferImpl::pollReadbacks (const bool)
+  {
+    // As above, every pixel reads as cleared. Readbacks finish at the first poll after their
+    // request, as if the graphics card were always done with them by then; any started by their
+    // callbacks are left for the next poll.
+    Collection<Shared<FrameBufferReadback>> readbacks;
+    std::swap(readbacks, m_readbacks);
+
+    for (const auto& readback : readbacks) {
+      readback->values.assign(readback->size.x * readback->size.y, -1);
+      finishReadback(*readback);
+    }
+
+    return m_readbacks.empty();
+  }
+
+  void FrameBufferImpl::beginReadback (const Shared<FrameBufferReadback>& readback)
+  {
+    Recorder::record(CommandType::READ_PIXELS, m_handle, readback->attachmentIndex,
+      readback->offset.x, readback->offset.y, readback->size.x * readback->size.y,
+      readback->size.x * readback->size.y * sizeof(I32));
+    m_readbacks.push_back(readback);
+  }
+
+  void FrameBufferImpl::onAllocatedSizeChanged ()
+  {
+    build();
+  }
+
+  void FrameBufferImpl::build ()
+  {
+    if (m_colorAttachmentSpecs.size() > FRAMEBUFFER_COLOR_ATTACHMENT_COUNT) {
+      DG_ENGINE_THROW(std::runtime_error,
+        "Attempt to build framebuffer with too many color attachments (max is {}; got {} instead)!",
+          FRAMEBUFFER_COLOR_ATTACHMENT_COUNT, m_colorAttachmentSpecs.size());
+    }
+
+    m_handle = Recorder::generateHandle();
+    m_colorHandles.resize(m_colorAttachmentSpecs.size());
+    for (auto& colorHandle : m_colorHandles) {
+      colorHandle = Recorder::generateHandle();
+    }
+
+    m_depthHandle = (m_depthAttachmentSpec.format != FrameBufferTextureFormat::NONE) ?
+      Recorder::generateHandle() : 0;
+
+    Recorder::record(CommandType::CREATE_FRAMEBUFFER, m_handle, m_allocatedSize.x,
+      m_allocatedSize.y, m_colorHandles.size(), m_spec.sampleCount);
+  }
+
+}
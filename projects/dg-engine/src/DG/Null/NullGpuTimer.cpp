@@ -0,0 +1,55 @@
+/** @file DG/Null/NullGpuTimer.cpp */
+
+#include <DG/Null/NullRecorder.hpp>
+#include <DG/Null/NullGpuTimer.hpp>
+
+namespace dg
+{
+
+  Unique<GpuTimer> GpuTimer::make (const Count latency)
+  {
+    return std::make_unique<Null::GpuTimerImpl>(latency);
+  }
+
+}
+
+namespace dg::Null
+{
+
+  GpuTimerImpl::GpuTimerImpl (const Count latency) :
+    GpuTimer {},
+    m_latency { latency }
+  {
+    if (latency == 0) {
+      DG_ENGINE_THROW(std::invalid_argument, "Attempt to create GPU timer with zero latency!");
+    }
+
+    m_handle = Recorder::generateHandle();
+  }
+
+  void GpuTimerImpl::beginFrame ()
+  {
+    Recorder::record(CommandType::TIMER_QUERY, m_handle, 0);
+  }
+
+  void GpuTimerImpl::endFrame ()
+  {
+    Recorder::record(CommandType::TIMER_QUERY, m_handle, 1);
+  }
+
+  void GpuTimerImpl::beginRange ()
+  {
+    Recorder::record(CommandType::TIMER_QUERY, m_handle, 2);
+  }
+
+  void GpuTimerImpl::endRange ()
+  {
+    Recorder::record(CommandType::TIMER_QUERY, m_handle, 3);
+  }
+
+  Count GpuTimerImpl::getLatency () const
+  {
+    return m_latency;
+  }
+
+}
@@ -0,0 +1,556 @@
+/** @file DG/Null/NullGraphicsBuffers.cpp */
+
+#include <DG/Null/NullRecorder.hpp>
+#include <DG/Null/NullGraphicsBuffers.hpp>
+
+namespace dg
+{
+
+  Shared<VertexBuffer> VertexBuffer::make (const void* data, const Size size, bool dynamic)
+  {
+    return std::make_shared<Null::VertexBufferImpl>(data, size, dynamic);
+  }
+
+  Shared<VertexBuffer> VertexBuffer::allocate (const Size size)
+  {
+    return std::make_shared<Null::VertexBufferImpl>(size);
+  }
+
+  Shared<StreamingVertexBuffer> StreamingVertexBuffer::make (const Size regionSize,
+    const Count regionCount)
+  {
+    return std::make_shared<Null::StreamingVertexBufferImpl>(regionSize, regionCount);
+  }
+
+  Shared<IndexBuffer> IndexBuffer::make (const Collection<U32>& indices, bool dynamic)
+  {
+    return std::make_shared<Null::IndexBufferImpl>(indices, dynamic);
+  }
+
+  Shared<IndexBuffer> IndexBuffer::allocate (const Count count)
+  {
+    return std::make_shared<Null::IndexBufferImpl>(count);
+  }
+
+  Shared<IndirectBuffer> IndirectBuffer::allocate (const Count commandCount)
+  {
+    return std::make_shared<Null::IndirectBufferImpl>(commandCount);
+  }
+
+  Shared<StreamingIndirectBuffer> StreamingIndirectBuffer::make (const Count regionCommandCount,
+    const Count regionCount)
+  {
+    return std::make_shared<Null::StreamingIndirectBufferImpl>(regionCommandCount, regionCount);
+  }
+
+  Shared<StorageBuffer> StorageBuffer::allocate (const Size size)
+  {
+    return std::make_shared<Null::StorageBufferImpl>(size);
+  }
+
+  Shared<StreamingStorageBuffer> StreamingStorageBuffer::make (const Size regionSize,
+    const Count regionCount)
+  {
+    return std::make_shared<Null::StreamingStorageBufferImpl>(regionSize, regionCount);
+  }
+
+  Shared<UniformBuffer> UniformBuffer::allocate (const Size size)
+  {
+    return std::make_shared<Null::UniformBufferImpl>(size);
+  }
+
+  Shared<PixelUploadBuffer> PixelUploadBuffer::make (const Size regionSize,
+    const Count regionCount)
+  {
+    return std::make_shared<Null::PixelUploadBufferImpl>(regionSize, regionCount);
+  }
+
+}
+
+namespace dg::Null
+{
+
+  VertexBufferImpl::VertexBufferImpl (const void* data, const Size size, bool dynamic) :
+    VertexBuffer {}
+  {
+    if (data == nullptr || size == 0) {
+      DG_ENGINE_THROW(std::invalid_argument, 
+        "Attempt to create vertex buffer with null data or zero size!");
+    }
+
+    m_handle = Recorder::generateHandle();
+    m_dynamic = dynamic;
+    m_byteSize = size;
+    Recorder::record(CommandType::CREATE_BUFFER, m_handle, size, 0, 0, 0, size);
+  }
+
+  VertexBufferImpl::VertexBufferImpl (const Size size) :
+    VertexBuffer {}
+  {
+    if (size == 0) {
+      DG_ENGINE_THROW(std::invalid_argument, 
+        "Attempt to allocate vertex buffer with zero size!");
+    }
+
+    m_handle = Recorder::generateHandle();
+    m_dynamic = true;
+    m_byteSize = size;
+    Recorder::record(CommandType::CREATE_BUFFER, m_handle, size);
+  }
+
+  void VertexBufferImpl::bind () const
+  {
+
+  }
+
+  void VertexBufferImpl::unbind () const
+  {
+
+  }
+
+  void VertexBufferImpl::upload (const void* data, const Size size)
+  {
+    uploadRange(data, size, 0);
+  }
+
+  void VertexBufferImpl::uploadRange (const void* data, const Size size, const Size offset)
+  {
+    if (m_dynamic == false) {
+      DG_ENGINE_THROW(std::runtime_error,
+        "Attempt to upload dynamic vertex data to non-dynamic vertex buffer!");
+    }
+
+    if (data == nullptr || size == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to upload null data or zero size to vertex buffer!");
+    }
+
+    if (offset + size > m_byteSize) {
+      DG_ENGINE_THROW(std::out_of_range,
+        "Attempt to upload {} bytes at offset {} to vertex buffer of {} bytes!", size, offset,
+          m_byteSize);
+    }
+
+    Recorder::record(CommandType::UPLOAD_BUFFER, m_handle, offset, size, 0, 0, size);
+  }
+
+
+
+  StreamingVertexBufferImpl::StreamingVertexBufferImpl (const Size regionSize,
+    const Count regionCount) :
+    StreamingVertexBuffer {}
+  {
+    if (regionSize == 0 || regionCount == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to allocate streaming vertex buffer with zero region size or count!");
+    }
+
+    m_handle = Recorder::generateHandle();
+    m_mapping.resize(regionSize * regionCount);
+    m_dynamic = true;
+    m_byteSize = m_mapping.size();
+    m_regionSize = regionSize;
+    m_regionCount = regionCount;
+    Recorder::record(CommandType::CREATE_BUFFER, m_handle, m_byteSize);
+  }
+
+  void StreamingVertexBufferImpl::bind () const
+  {
+
+  }
+
+  void StreamingVertexBufferImpl::unbind () const
+  {
+
+  }
+
+  void StreamingVertexBufferImpl::upload (const void* data, const Size size)
+  {
+    uploadRange(data, size, 0);
+  }
+
+  void StreamingVertexBufferImpl::uploadRange (const void* data, const Size size,
+    const Size offset)
+  {
+    if (data == nullptr || size == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to upload null data or zero size to streaming vertex buffer!");
+    }
+
+    if (offset + size > m_regionSize) {
+      DG_ENGINE_THROW(std::out_of_range,
+        "Attempt to upload {} bytes at offset {} to streaming vertex buffer region of {} bytes!",
+          size, offset, m_regionSize);
+    }
+
+    std::memcpy(static_cast<U8*>(acquireRegion()) + offset, data, size);
+    Recorder::record(CommandType::UPLOAD_BUFFER, m_handle, getRegionOffset() + offset, size,
+      0, 0, size);
+  }
+
+  void* StreamingVertexBufferImpl::acquireRegion ()
+  {
+    if (m_regionAcquired == false) {
+      Recorder::record(CommandType::ACQUIRE_REGION, m_handle, m_regionIndex);
+      m_regionAcquired = true;
+    }
+
+    return m_mapping.data() + getRegionOffset();
+  }
+
+  void StreamingVertexBufferImpl::releaseRegion ()
+  {
+    if (m_regionAcquired == false) {
+      DG_ENGINE_THROW(std::runtime_error,
+        "Attempt to release unacquired streaming vertex buffer region {}!", m_regionIndex);
+    }
+
+    Recorder::record(CommandType::RELEASE_REGION, m_handle, m_regionIndex);
+    m_regionIndex = (m_regionIndex + 1) % m_regionCount;
+    m_regionAcquired = false;
+  }
+
+
+
+  IndexBufferImpl::IndexBufferImpl (const Collection<U32>& indices, bool dynamic) :
+    IndexBuffer {}
+  {
+    if (indices.empty() == true) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to create index buffer with no index data!");
+    }
+
+    Size size = indices.size() * sizeof(U32);
+    m_handle = Recorder::generateHandle();
+    m_dynamic = dynamic;
+    m_indexCount = indices.size();
+    Recorder::record(CommandType::CREATE_BUFFER, m_handle, size, 0, 0, 0, size);
+  }
+
+  IndexBufferImpl::IndexBufferImpl (const Count count) :
+    IndexBuffer {}
+  {
+    if (count == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to create index buffer with zero index count!");
+    }
+
+    m_handle = Recorder::generateHandle();
+    m_dynamic = true;
+    m_indexCount = count;
+    Recorder::record(CommandType::CREATE_BUFFER, m_handle, count * sizeof(U32));
+  }
+
+  void IndexBufferImpl::bind () const
+  {
+
+  }
+
+  void IndexBufferImpl::unbind () const
+  {
+
+  }
+
+
+
+  IndirectBufferImpl::IndirectBufferImpl (const Count commandCount) :
+    IndirectBuffer {}
+  {
+    if (commandCount == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to allocate indirect buffer with zero command count!");
+    }
+
+    m_handle = Recorder::generateHandle();
+    m_commandCount = commandCount;
+    Recorder::record(CommandType::CREATE_BUFFER, m_handle,
+      commandCount * sizeof(DrawIndexedIndirectCommand));
+  }
+
+  void IndirectBufferImpl::bind () const
+  {
+
+  }
+
+  void IndirectBufferImpl::unbind () const
+  {
+
+  }
+
+  void IndirectBufferImpl::upload (const DrawIndexedIndirectCommand* commands, const Count count)
+  {
+    if (commands == nullptr || count == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to upload null or zero commands to indirect buffer!");
+    }
+
+    if (count > m_commandCount) {
+      DG_ENGINE_THROW(std::out_of_range,
+        "Attempt to upload {} commands to indirect buffer of {} commands!", count,
+          m_commandCount);
+    }
+
+    Size size = count * sizeof(DrawIndexedIndirectCommand);
+    Recorder::record(CommandType::UPLOAD_BUFFER, m_handle, 0, size, 0, 0, size);
+  }
+
+
+
+  StreamingIndirectBufferImpl::StreamingIndirectBufferImpl (const Count regionCommandCount,
+    const Count regionCount) :
+    StreamingIndirectBuffer {}
+  {
+    if (regionCommandCount == 0 || regionCount == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to allocate streaming indirect buffer with zero region size or count!");
+    }
+
+    m_handle = Recorder::generateHandle();
+    m_mapping.resize(regionCommandCount * regionCount);
+    m_commandCount = m_mapping.size();
+    m_regionCommandCount = regionCommandCount;
+    m_regionCount = regionCount;
+    Recorder::record(CommandType::CREATE_BUFFER, m_handle,
+      m_commandCount * sizeof(DrawIndexedIndirectCommand));
+  }
+
+  void StreamingIndirectBufferImpl::bind () const
+  {
+
+  }
+
+  void StreamingIndirectBufferImpl::unbind () const
+  {
+
+  }
+
+  void StreamingIndirectBufferImpl::upload (const DrawIndexedIndirectCommand* commands,
+    const Count count)
+  {
+    if (commands == nullptr || count == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to upload null or zero commands to streaming indirect buffer!");
+    }
+
+    if (count > m_regionCommandCount) {
+      DG_ENGINE_THROW(std::out_of_range,
+        "Attempt to upload {} commands to streaming indirect buffer region of {} commands!",
+          count, m_regionCommandCount);
+    }
+
+    Size size = count * sizeof(DrawIndexedIndirectCommand);
+    std::memcpy(acquireRegion(), commands, size);
+    Recorder::record(CommandType::UPLOAD_BUFFER, m_handle,
+      getRegionFirstCommand() * sizeof(DrawIndexedIndirectCommand), size, 0, 0, size);
+  }
+
+  DrawIndexedIndirectCommand* StreamingIndirectBufferImpl::acquireRegion ()
+  {
+    if (m_regionAcquired == false) {
+      Recorder::record(CommandType::ACQUIRE_REGION, m_handle, m_regionIndex);
+      m_regionAcquired = true;
+    }
+
+    return m_mapping.data() + getRegionFirstCommand();
+  }
+
+  void StreamingIndirectBufferImpl::releaseRegion ()
+  {
+    if (m_regionAcquired == false) {
+      DG_ENGINE_THROW(std::runtime_error,
+        "Attempt to release unacquired streaming indirect buffer region {}!", m_regionIndex);
+    }
+
+    Recorder::record(CommandType::RELEASE_REGION, m_handle, m_regionIndex);
+    m_regionIndex = (m_regionIndex + 1) % m_regionCount;
+    m_regionAcquired = false;
+  }
+
+
+
+  StorageBufferImpl::StorageBufferImpl (const Size size) :
+    StorageBuffer {}
+  {
+    if (size == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to allocate storage buffer with zero size!");
+    }
+
+    m_handle = Recorder::generateHandle();
+    m_byteSize = size;
+    Recorder::record(CommandType::CREATE_BUFFER, m_handle, size);
+  }
+
+  void StorageBufferImpl::bind (const Index) const
+  {
+
+  }
+
+  void StorageBufferImpl::unbind (const Index) const
+  {
+
+  }
+
+  void StorageBufferImpl::upload (const void* data, const Size size)
+  {
+    if (data == nullptr || size == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to upload null data or zero size to storage buffer!");
+    }
+
+    if (size > m_byteSize) {
+      DG_ENGINE_THROW(std::out_of_range,
+        "Attempt to upload {} bytes to storage buffer of {} bytes!", size, m_byteSize);
+    }
+
+    Recorder::record(CommandType::UPLOAD_BUFFER, m_handle, 0, size, 0, 0, size);
+  }
+
+
+
+  StreamingStorageBufferImpl::StreamingStorageBufferImpl (const Size regionSize,
+    const Count regionCount) :
+    StreamingStorageBuffer {}
+  {
+    if (regionSize == 0 || regionCount == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to allocate streaming storage buffer with zero region size or count!");
+    }
+
+    m_handle = Recorder::generateHandle();
+    m_mapping.resize(regionSize * regionCount);
+    m_byteSize = m_mapping.size();
+    m_regionSize = regionSize;
+    m_regionCount = regionCount;
+    Recorder::record(CommandType::CREATE_BUFFER, m_handle, m_byteSize);
+  }
+
+  void StreamingStorageBufferImpl::bind (const Index) const
+  {
+
+  }
+
+  void StreamingStorageBufferImpl::unbind (const Index) const
+  {
+
+  }
+
+  void StreamingStorageBufferImpl::upload (const void* data, const Size size)
+  {
+    if (data == nullptr || size == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to upload null data or zero size to streaming storage buffer!");
+    }
+
+    if (size > m_regionSize) {
+      DG_ENGINE_THROW(std::out_of_range,
+        "Attempt to upload {} bytes to streaming storage buffer region of {} bytes!", size,
+          m_regionSize);
+    }
+
+    std::memcpy(acquireRegion(), data, size);
+    Recorder::record(CommandType::UPLOAD_BUFFER, m_handle, getRegionOffset(), size, 0, 0, size);
+  }
+
+  void* StreamingStorageBufferImpl::acquireRegion ()
+  {
+    if (m_regionAcquired == false) {
+      Recorder::record(CommandType::ACQUIRE_REGION, m_handle, m_regionIndex);
+      m_regionAcquired = true;
+    }
+
+    return m_mapping.data() + getRegionOffset();
+  }
+
+  void StreamingStorageBufferImpl::releaseRegion ()
+  {
+    if (m_regionAcquired == false) {
+      DG_ENGINE_THROW(std::runtime_error,
+        "Attempt to release unacquired streaming storage buffer region {}!", m_regionIndex);
+    }
+
+    Recorder::record(CommandType::RELEASE_REGION, m_handle, m_regionIndex);
+    m_regionIndex = (m_regionIndex + 1) % m_regionCount;
+    m_regionAcquired = false;
+  }
+
+
+
+  UniformBufferImpl::UniformBufferImpl (const Size size) :
+    UniformBuffer {}
+  {
+    if (size == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to allocate uniform buffer with zero size!");
+    }
+
+    m_handle = Recorder::generateHandle();
+    m_byteSize = size;
+    Recorder::record(CommandType::CREATE_BUFFER, m_handle, size);
+  }
+
+  void UniformBufferImpl::bind (const Index) const
+  {
+
+  }
+
+  void UniformBufferImpl::unbind (const Index) const
+  {
+
+  }
+
+  void UniformBufferImpl::upload (const void* data, const Size size)
+  {
+    if (data == nullptr || size == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to upload null data or zero size to uniform buffer!");
+    }
+
+    if (size > m_byteSize) {
+      DG_ENGINE_THROW(std::out_of_range,
+        "Attempt to upload {} bytes to uniform buffer of {} bytes!", size, m_byteSize);
+    }
+
+    Recorder::record(CommandType::UPLOAD_BUFFER, m_handle, 0, size, 0, 0, size);
+  }
+
+
+
+  PixelUploadBufferImpl::PixelUploadBufferImpl (const Size regionSize, const Count regionCount) :
+    PixelUploadBuffer {}
+  {
+    if (regionSize == 0 || regionCount == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to allocate pixel upload buffer with zero region size or count!");
+    }
+
+    m_handle = Recorder::generateHandle();
+    m_mapping.resize(regionSize * regionCount);
+    m_regionSize = regionSize;
+    m_regionCount = regionCount;
+    Recorder::record(CommandType::CREATE_BUFFER, m_handle, m_mapping.size());
+  }
+
+  void* PixelUploadBufferImpl::acquireRegion ()
+  {
+    if (m_regionAcquired == false) {
+      Recorder::record(CommandType::ACQUIRE_REGION, m_handle, m_regionIndex);
+      m_regionAcquired = true;
+    }
+
+    return m_mapping.data() + getRegionOffset();
+  }
+
+  void PixelUploadBufferImpl::releaseRegion ()
+  {
+    if (m_regionAcquired == false) {
+      DG_ENGINE_THROW(std::runtime_error,
+        "Attempt to release unacquired pixel upload buffer region {}!", m_regionIndex);
+    }
+
+    Recorder::record(CommandType::RELEASE_REGION, m_handle, m_regionIndex);
+    m_regionIndex = (m_regionIndex + 1) % m_regionCount;
+    m_regionAcquired = false;
+  }
+
+}
@@ -0,0 +1,41 @@
+/** @file DG/Null/NullRecorder.cpp */
+
+#include <DG/Null/NullRecorder.hpp>
+
+namespace dg::Null
+{
+
+  Collection<Command> Recorder::s_commands;
+  Count Recorder::s_callCounts[COMMAND_TYPE_COUNT] = {};
+  Size Recorder::s_byteCounts[COMMAND_TYPE_COUNT] = {};
+  Size Recorder::s_totalByteCount = 0;
+  U32 Recorder::s_nextHandle = 1;
+  bool Recorder::s_streamEnabled = true;
+
+  U32 Recorder::generateHandle ()
+  {
+    return s_nextHandle++;
+  }
+
+  void Recorder::record (const CommandType type, const U32 object, const I64 first,
+    const I64 second, const I64 third, const I64 fourth, const Size byteCount)
+  {
+    Index index = static_cast<Index>(type);
+    s_callCounts[index]++;
+    s_byteCounts[index] += byteCount;
+    s_totalByteCount += byteCount;
+
+    if (s_streamEnabled == true) {
+      s_commands.push_back({ type, object, { first, second, third, fourth }, byteCount });
+    }
+  }
+
+  void Recorder::reset ()
+  {
+    s_commands.clear();
+    std::fill(std::begin(s_callCounts), std::end(s_callCounts), 0);
+    std::fill(std::begin(s_byteCounts), std::end(s_byteCounts), 0);
+    s_totalByteCount = 0;
+  }
+
+}
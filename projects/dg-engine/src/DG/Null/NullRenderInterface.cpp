@@ -0,0 +1,129 @@
+/** @file DG/Null/NullRenderInterface.cpp */
+
+#include <DG/Null/NullRecorder.hpp>
+#include <DG/Null/NullGraphicsBuffers.hpp>
+#include <DG/Null/NullVertexArray.hpp>
+#include <DG/Null/NullRenderInterface.hpp>
+
+namespace dg
+{
+
+  Unique<RenderInterface> RenderInterface::make ()
+  {
+    return std::make_unique<Null::RenderInterfaceImpl>();
+  }
+
+}
+
+namespace dg::Null
+{
+
+  static U32 resolveIndexedDraw (const Shared<VertexArray>& vao, Count& indexCount)
+  {
+    if (vao == nullptr) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to render null vertex array object!");
+    }
+
+    const auto& ibo = vao->getIndexBuffer();
+    if (ibo == nullptr) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to render vertex array with no index buffer bound!");
+    }
+
+    if (indexCount == 0 || indexCount > ibo->getIndexCount()) {
+      indexCount = ibo->getIndexCount();
+    }
+
+    return static_cast<const VertexArrayImpl&>(*vao).getHandle();
+  }
+
+  static U32 getIndirectHandle (const Shared<IndirectBuffer>& commands)
+  {
+    // The streaming indirect buffer does not share the plain one's implementation.
+    if (auto streaming = dynamic_cast<const StreamingIndirectBufferImpl*>(commands.get())) {
+      return streaming->getHandle();
+    }
+
+    return static_cast<const IndirectBufferImpl&>(*commands).getHandle();
+  }
+
+  RenderInterfaceImpl::RenderInterfaceImpl () :
+    RenderInterface {}
+  {
+
+  }
+
+  RenderInterfaceImpl::~RenderInterfaceImpl ()
+  {
+
+  }
+
+  void RenderInterfaceImpl::clear ()
+  {
+    Recorder::record(CommandType::CLEAR, 0);
+  }
+
+  void RenderInterfaceImpl::setClearColor (const Vector4f&)
+  {
+    Recorder::record(CommandType::SET_CLEAR_COLOR, 0);
+  }
+
+  void RenderInterfaceImpl::setViewport (I32 x, I32 y, I32 width, I32 height)
+  {
+    Recorder::record(CommandType::SET_VIEWPORT, 0, x, y, width, height);
+  }
+
+  void RenderInterfaceImpl::setViewport (I32 width, I32 height)
+  {
+    setViewport(0, 0, width, height);
+  }
+
+  void RenderInterfaceImpl::drawIndexed (const Shared<VertexArray>& vao, Count indexCount,
+    Count baseVertex)
+  {
+    U32 handle = resolveIndexedDraw(vao, indexCount);
+    vao->bind();
+    Recorder::record(CommandType::DRAW_INDEXED, handle, indexCount, baseVertex);
+  }
+
+  void RenderInterfaceImpl::drawIndexedInstanced (const Shared<VertexArray>& vao,
+    Count indexCount, Count instanceCount, Count baseInstance)
+  {
+    U32 handle = resolveIndexedDraw(vao, indexCount);
+    if (instanceCount == 0) { return; }
+
+    vao->bind();
+    Recorder::record(CommandType::DRAW_INDEXED_INSTANCED, handle, indexCount, instanceCount,
+      baseInstance);
+  }
+
+  void RenderInterfaceImpl::multiDrawIndexedIndirect (const Shared<VertexArray>& vao,
+    const Shared<IndirectBuffer>& commands, Count drawCount, Index firstCommand)
+  {
+    if (commands == nullptr) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to multi-draw null indirect buffer!");
+    }
+
+    Count indexCount = 0;
+    U32 handle = resolveIndexedDraw(vao, indexCount);
+    if (firstCommand + drawCount > commands->getCommandCount()) {
+      DG_ENGINE_THROW(std::out_of_range,
+        "Attempt to multi-draw {} commands from command {} of indirect buffer of {} commands!",
+          drawCount, firstCommand, commands->getCommandCount());
+    }
+
+    if (drawCount == 0) { return; }
+
+    vao->bind();
+    Recorder::record(CommandType::MULTI_DRAW_INDEXED_INDIRECT, handle, getIndirectHandle(commands),
+      drawCount, firstCommand);
+  }
+
+  Count RenderInterfaceImpl::getTextureUnitCount () const
+  {
+    return TEXTURE_UNIT_COUNT;
+  }
+
+}
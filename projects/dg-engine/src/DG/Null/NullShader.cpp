@@ -0,0 +1,395 @@
+/** @file DG/Null/NullShader.cpp */
+
+#include <DG/Null/NullRecorder.hpp>
+#include <DG/Null/NullShader.hpp>
+
+namespace dg
+{
+
+  Shared<Shader> Shader::make (const Path& path)
+  {
+    return std::make_shared<Null::ShaderImpl>(path);
+  }
+
+  Shared<Shader> Shader::make (const String& vertexCode, const String& fragmentCode)
+  {
+    return std::make_shared<Null::ShaderImpl>(vertexCode, fragmentCode);
+  }
+
+  Shared<Shader> Shader::makeAsync (const Path& path)
+  {
+    return std::make_shared<Null::ShaderImpl>(path);
+  }
+
+  Shared<Shader> Shader::makeAsync (const String& vertexCode, const String& fragmentCode)
+  {
+    return std::make_shared<Null::ShaderImpl>(vertexCode, fragmentCode);
+  }
+
+  Shared<Shader> Shader::makePermutation (const Path& path, const ShaderDefines& defines,
+    bool)
+  {
+    return std::make_shared<Null::ShaderImpl>(path, defines);
+  }
+
+}
+
+namespace dg::Null
+{
+
+  ShaderImpl::ShaderImpl (const Path& path, const ShaderDefines& defines) :
+    Shader {}
+  {
+    m_ready = true;
+
+    // Nothing is compiled, but the file is still preprocessed into its stages, so that a shader
+    // file which would not have built on a graphics card is not silently accepted.
+    ShaderSource source;
+    bool result = ShaderPreprocessor::load(path, defines, source);
+    if (result == false || source.vertexCode.empty() == true ||
+      source.fragmentCode.empty() == true) {
+      DG_ENGINE_ERROR("Could not parse shader file '{}'.", path);
+      return;
+    }
+
+    m_handle = Recorder::generateHandle();
+    m_valid = true;
+    Recorder::record(CommandType::CREATE_SHADER, m_handle);
+  }
+
+  ShaderImpl::ShaderImpl (const String& vertexCode, const String& fragmentCode) :
+    Shader {}
+  {
+    m_ready = true;
+    if (vertexCode.empty() == true || fragmentCode.empty() == true) {
+      DG_ENGINE_ERROR("Could not build shader from source code.");
+      return;
+    }
+
+    m_handle = Recorder::generateHandle();
+    m_valid = true;
+    Recorder::record(CommandType::CREATE_SHADER, m_handle);
+  }
+
+  ShaderImpl::~ShaderImpl ()
+  {
+
+  }
+
+  void ShaderImpl::bind () const
+  {
+    Recorder::record(CommandType::BIND_SHADER, m_handle);
+  }
+
+  void ShaderImpl::unbind () const
+  {
+    Recorder::record(CommandType::BIND_SHADER, 0);
+  }
+
+  bool ShaderImpl::poll ()
+  {
+    return true;
+  }
+
+  void ShaderImpl::wait ()
+  {
+
+  }
+
+  UniformHandle ShaderImpl::findUniform (const String& name) const
+  {
+    // With no program to reflect, every uniform name is taken to exist, and is given the next
+    // location when first found.
+    auto iter = m_uniforms.try_emplace(name, static_cast<I32>(m_uniforms.size())).first;
+    return { iter->second, m_handle };
+  }
+
+  bool ShaderImpl::setInteger (const String& key, I32 value)
+  {
+    return setInteger(findUniform(key), value);
+  }
+
+  bool ShaderImpl::setUnsignedInteger (const String& key, U32 value)
+  {
+    return setUnsignedInteger(findUniform(key), value);
+  }
+
+  bool ShaderImpl::setFloat (const String& key, F32 value)
+  {
+    return setFloat(findUniform(key), value);
+  }
+
+  bool ShaderImpl::setDouble (const String& key, F64 value)
+  {
+    return setDouble(findUniform(key), value);
+  }
+
+  bool ShaderImpl::setBoolean (const String& key, bool value)
+  {
+    return setBoolean(findUniform(key), value);
+  }
+
+  bool ShaderImpl::setVector2i (const String& key, const Vector2i& value)
+  {
+    return setVector2i(findUniform(key), value);
+  }
+
+  bool ShaderImpl::setVector2u (const String& key, const Vector2u& value)
+  {
+    return setVector2u(findUniform(key), value);
+  }
+
+  bool ShaderImpl::setVector2f (const String& key, const Vector2f& value)
+  {
+    return setVector2f(findUniform(key), value);
+  }
+
+  bool ShaderImpl::setVector2d (const String& key, const Vector2d& value)
+  {
+    return setVector2d(findUniform(key), value);
+  }
+
+  bool ShaderImpl::setVector2b (const String& key, const Vector2b& value)
+  {
+    return setVector2b(findUniform(key), value);
+  }
+
+  bool ShaderImpl::setVector3i (const String& key, const Vector3i& value)
+  {
+    return setVector3i(findUniform(key), value);
+  }
+
+  bool ShaderImpl::setVector3u (const String& key, const Vector3u& value)
+  {
+    return setVector3u(findUniform(key), value);
+  }
+
+  bool ShaderImpl::setVector3f (const String& key, const Vector3f& value)
+  {
+    return setVector3f(findUniform(key), value);
+  }
+
+  bool ShaderImpl::setVector3d (const String& key, const Vector3d& value)
+  {
+    return setVector3d(findUniform(key), value);
+  }
+
+  bool ShaderImpl::setVector3b (const String& key, const Vector3b& value)
+  {
+    return setVector3b(findUniform(key), value);
+  }
+
+  bool ShaderImpl::setVector4i (const String& key, const Vector4i& value)
+  {
+    return setVector4i(findUniform(key), value);
+  }
+
+  bool ShaderImpl::setVector4u (const String& key, const Vector4u& value)
+  {
+    return setVector4u(findUniform(key), value);
+  }
+
+  bool ShaderImpl::setVector4f (const String& key, const Vector4f& value)
+  {
+    return setVector4f(findUniform(key), value);
+  }
+
+  bool ShaderImpl::setVector4d (const String& key, const Vector4d& value)
+  {
+    return setVector4d(findUniform(key), value);
+  }
+
+  bool ShaderImpl::setVector4b (const String& key, const Vector4b& value)
+  {
+    return setVector4b(findUniform(key), value);
+  }
+
+  bool ShaderImpl::setMatrix2f (const String& key, const Matrix2f& value)
+  {
+    return setMatrix2f(findUniform(key), value);
+  }
+
+  bool ShaderImpl::setMatrix3f (const String& key, const Matrix3f& value)
+  {
+    return setMatrix3f(findUniform(key), value);
+  }
+
+  bool ShaderImpl::setMatrix4f (const String& key, const Matrix4f& value)
+  {
+    return setMatrix4f(findUniform(key), value);
+  }
+
+  bool ShaderImpl::setMatrix2d (const String& key, const Matrix2d& value)
+  {
+    return setMatrix2d(findUniform(key), value);
+  }
+
+  bool ShaderImpl::setMatrix3d (const String& key, const Matrix3d& value)
+  {
+    return setMatrix3d(findUniform(key), value);
+  }
+
+  bool ShaderImpl::setMatrix4d (const String& key, const Matrix4d& value)
+  {
+    return setMatrix4d(findUniform(key), value);
+  }
+
+  bool ShaderImpl::setInteger (UniformHandle uniform, I32)
+  {
+    return setUniform(uniform, sizeof(I32));
+  }
+
+  bool ShaderImpl::setUnsignedInteger (UniformHandle uniform, U32)
+  {
+    return setUniform(uniform, sizeof(U32));
+  }
+
+  bool ShaderImpl::setFloat (UniformHandle uniform, F32)
+  {
+    return setUniform(uniform, sizeof(F32));
+  }
+
+  bool ShaderImpl::setDouble (UniformHandle uniform, F64)
+  {
+    return setUniform(uniform, sizeof(F64));
+  }
+
+  bool ShaderImpl::setBoolean (UniformHandle uniform, bool)
+  {
+    return setUniform(uniform, sizeof(bool));
+  }
+
+  bool ShaderImpl::setVector2i (UniformHandle uniform, const Vector2i&)
+  {
+    return setUniform(uniform, sizeof(Vector2i));
+  }
+
+  bool ShaderImpl::setVector2u (UniformHandle uniform, const Vector2u&)
+  {
+    return setUniform(uniform, sizeof(Vector2u));
+  }
+
+  bool ShaderImpl::setVector2f (UniformHandle uniform, const Vector2f&)
+  {
+    return setUniform(uniform, sizeof(Vector2f));
+  }
+
+  bool ShaderImpl::setVector2d (UniformHandle uniform, const Vector2d&)
+  {
+    return setUniform(uniform, sizeof(Vector2d));
+  }
+
+  bool ShaderImpl::setVector2b (UniformHandle uniform, const Vector2b&)
+  {
+    return setUniform(uniform, sizeof(Vector2b));
+  }
+
+  bool ShaderImpl::setVector3i (UniformHandle uniform, const Vector3i&)
+  {
+    return setUniform(uniform, sizeof(Vector3i));
+  }
+
+  bool ShaderImpl::setVector3u (UniformHandle uniform, const Vector3u&)
+  {
+    return setUniform(uniform, sizeof(Vector3u));
+  }
+
+  bool ShaderImpl::setVector3f (UniformHandle uniform, const Vector3f&)
+  {
+    return setUniform(uniform, sizeof(Vector3f));
+  }
+
+  bool ShaderImpl::setVector3d (UniformHandle uniform, const Vector3d&)
+  {
+    return setUniform(uniform, sizeof(Vector3d));
+  }
+
+  bool ShaderImpl::setVector3b (UniformHandle uniform, const Vector3b&)
+  {
+    return setUniform(uniform, sizeof(Vector3b));
+  }
+
+  bool ShaderImpl::setVector4i (UniformHandle uniform, const Vector4i&)
+  {
+    return setUniform(uniform, sizeof(Vector4i));
+  }
+
+  bool ShaderImpl::setVector4u (UniformHandle uniform, const Vector4u&)
+  {
+    return setUniform(uniform, sizeof(Vector4u));
+  }
+
+  bool ShaderImpl::setVector4f (UniformHandle uniform, const Vector4f&)
+  {
+    return setUniform(uniform, sizeof(Vector4f));
+  }
+
+  bool ShaderImpl::setVector4d (UniformHandle uniform, const Vector4d&)
+  {
+    return setUniform(uniform, sizeof(Vector4d));
+  }
+
+  bool ShaderImpl::setVector4b (UniformHandle uniform, const Vector4b&)
+  {
+    return setUniform(uniform, sizeof(Vector4b));
+  }
+
+  bool ShaderImpl::setMatrix2f (UniformHandle uniform, const Matrix2f&)
+  {
+    return setUniform(uniform, sizeof(Matrix2f));
+  }
+
+  bool ShaderImpl::setMatrix3f (UniformHandle uniform, const Matrix3f&)
+  {
+    return setUniform(uniform, sizeof(Matrix3f));
+  }
+
+  bool ShaderImpl::setMatrix4f (UniformHandle uniform, const Matrix4f&)
+  {
+    return setUniform(uniform, sizeof(Matrix4f));
+  }
+
+  bool ShaderImpl::setMatrix2d (UniformHandle uniform, const Matrix2d&)
+  {
+    return setUniform(uniform, sizeof(Matrix2d));
+  }
+
+  bool ShaderImpl::setMatrix3d (UniformHandle uniform, const Matrix3d&)
+  {
+    return setUniform(uniform, sizeof(Matrix3d));
+  }
+
+  bool ShaderImpl::setMatrix4d (UniformHandle uniform, const Matrix4d&)
+  {
+    return setUniform(uniform, sizeof(Matrix4d));
+  }
+
+  bool ShaderImpl::setIntegerArray (UniformHandle uniform, const I32* values, const Count count)
+  {
+    if (values == nullptr || count == 0) { return false; }
+    return setUniform(uniform, count * sizeof(I32));
+  }
+
+  bool ShaderImpl::setUniform (UniformHandle uniform, const Size size)
+  {
+    if (m_valid == false) {
+      DG_ENGINE_THROW(std::runtime_error,
+        "Attempt to set uniform on an invalid shader!");
+    }
+
+    if (uniform.isValid() == false) { return false; }
+
+    if (uniform.program != m_handle) {
+      #if defined(DG_DEBUG)
+        DG_ENGINE_THROW(std::invalid_argument,
+          "Attempt to set uniform through a handle found in another shader!");
+      #endif
+
+      return false;
+    }
+
+    Recorder::record(CommandType::SET_UNIFORM, m_handle, uniform.location, 0, 0, 0, size);
+    return true;
+  }
+
+}
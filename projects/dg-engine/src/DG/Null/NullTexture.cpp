@@ -0,0 +1,278 @@
+/** @file DG/Null/NullTexture.cpp */
+
+#include <DG/Graphics/GraphicsBuffers.hpp>
+#include <DG/Null/NullRecorder.hpp>
+#include <DG/Null/NullTexture.hpp>
+
+namespace dg
+{
+
+  Shared<Texture> Texture::make (const TextureSpecification& spec)
+  {
+    return std::make_shared<Null::TextureImpl>(spec);
+  }
+
+  Shared<Texture> Texture::make (const Path& path)
+  {
+    return std::make_shared<Null::TextureImpl>(path);
+  }
+
+  Shared<TextureArray> TextureArray::make (const TextureArraySpecification& spec)
+  {
+    return std::make_shared<Null::TextureArrayImpl>(spec);
+  }
+
+}
+
+namespace dg::Null
+{
+
+  TextureImpl::TextureImpl (const Path& path) :
+    Texture {}
+  {
+    m_handle = Recorder::generateHandle();
+    loadFromFile(path);
+  }
+
+  TextureImpl::TextureImpl (const TextureSpecification& spec) :
+    Texture { spec }
+  {
+    m_handle = Recorder::generateHandle();
+    m_valid = initializeTexture();
+    if (m_valid == true) {
+      Recorder::record(CommandType::CREATE_TEXTURE, m_handle, m_size.x, m_size.y,
+        m_colorChannelCount);
+    }
+  }
+
+  void TextureImpl::bind (const Index slot) const
+  {
+    if (slot >= TEXTURE_UNIT_COUNT_MAX) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to bind texture to invalid slot number {}!", slot);
+    }
+
+    Recorder::record(CommandType::BIND_TEXTURE, m_handle, slot);
+  }
+
+  void TextureImpl::unbind (const Index slot) const
+  {
+    if (slot >= TEXTURE_UNIT_COUNT_MAX) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to unbind texture from invalid slot number {}!", slot);
+    }
+
+    Recorder::record(CommandType::BIND_TEXTURE, 0, slot);
+  }
+
+  void TextureImpl::upload (const void* data, const Size size)
+  {
+    if (data == nullptr || size == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to upload null data or zero size to texture!");
+    }
+
+    Size expectedSize = (m_size.x * m_size.y * m_colorChannelCount);
+    if (size != expectedSize) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to upload data of mismatched size to texture (expected {} bytes; got {} instead)!",
+          expectedSize, size);
+    }
+
+    Recorder::record(CommandType::UPLOAD_TEXTURE, m_handle, 0, 0, m_size.x, m_size.y, size);
+    m_revision++;
+  }
+
+  void TextureImpl::uploadRegion (const Vector2i& offset, const Vector2i& size, const void* data,
+    const Size dataSize)
+  {
+    if (data == nullptr || dataSize == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to upload null data or zero size to texture region!");
+    }
+
+    if (
+      offset.x < 0 || offset.y < 0 || size.x <= 0 || size.y <= 0 ||
+      offset.x + size.x > m_size.x || offset.y + size.y > m_size.y
+    ) {
+      DG_ENGINE_THROW(std::out_of_range,
+        "Attempt to upload to out of range texture region!");
+    }
+
+    Size expectedSize = (size.x * size.y * m_colorChannelCount);
+    if (dataSize != expectedSize) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to upload data of mismatched size to texture region (expected {} bytes; got {} instead)!",
+          expectedSize, dataSize);
+    }
+
+    Recorder::record(CommandType::UPLOAD_TEXTURE, m_handle, offset.x, offset.y, size.x, size.y,
+      dataSize);
+    m_revision++;
+  }
+
+  void TextureImpl::uploadRegion (const Vector2i& offset, const Vector2i& size,
+    const PixelUploadBuffer& buffer, const Size bufferOffset)
+  {
+    if (buffer.isRegionAcquired() == false) {
+      DG_ENGINE_THROW(std::runtime_error,
+        "Attempt to upload to texture region from unacquired pixel upload buffer region!");
+    }
+
+    if (
+      offset.x < 0 || offset.y < 0 || size.x <= 0 || size.y <= 0 ||
+      offset.x + size.x > m_size.x || offset.y + size.y > m_size.y
+    ) {
+      DG_ENGINE_THROW(std::out_of_range,
+        "Attempt to upload to out of range texture region!");
+    }
+
+    Size dataSize = (size.x * size.y * m_colorChannelCount);
+    if (bufferOffset + dataSize > buffer.getRegionSize()) {
+      DG_ENGINE_THROW(std::out_of_range,
+        "Attempt to upload {} bytes at offset {} from pixel upload buffer region of {} bytes!",
+          dataSize, bufferOffset, buffer.getRegionSize());
+    }
+
+    Recorder::record(CommandType::UPLOAD_TEXTURE, m_handle, offset.x, offset.y, size.x, size.y,
+      dataSize);
+    m_revision++;
+  }
+
+  void TextureImpl::swapStorage (Texture& other)
+  {
+    std::swap(m_handle, static_cast<TextureImpl&>(other).m_handle);
+    swapProperties(other);
+  }
+
+  void* TextureImpl::getPointer () const
+  {
+    return (void*) (intptr_t) m_handle;
+  }
+
+  bool TextureImpl::initializeTexture ()
+  {
+    if (m_colorChannelCount < 1 || m_colorChannelCount > 4) {
+      DG_ENGINE_ERROR("Texture has invalid color channel count {}.", m_colorChannelCount);
+      return false;
+    }
+
+    return true;
+  }
+
+  bool TextureImpl::onImageDataLoaded (const void* data)
+  {
+    if (data == nullptr) {
+      return false;
+    }
+
+    if (initializeTexture() == false) {
+      return false;
+    }
+
+    Recorder::record(CommandType::CREATE_TEXTURE, m_handle, m_size.x, m_size.y,
+      m_colorChannelCount, 0, m_size.x * m_size.y * m_colorChannelCount);
+
+    return true;
+  }
+
+
+
+  TextureArrayImpl::TextureArrayImpl (const TextureArraySpecification& spec) :
+    TextureArray { spec }
+  {
+    if (m_colorChannelCount < 1 || m_colorChannelCount > 4) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to create texture array with invalid color channel count {}!",
+          m_colorChannelCount);
+    }
+
+    if (m_size.x <= 0 || m_size.y <= 0 || m_layerCount == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to create texture array with zero size or no layers!");
+    }
+
+    m_handle = Recorder::generateHandle();
+    Recorder::record(CommandType::CREATE_TEXTURE, m_handle, m_size.x, m_size.y,
+      m_colorChannelCount, m_layerCount);
+  }
+
+  void TextureArrayImpl::bind (const Index slot) const
+  {
+    if (slot >= TEXTURE_UNIT_COUNT_MAX) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to bind texture array to invalid slot number {}!", slot);
+    }
+
+    Recorder::record(CommandType::BIND_TEXTURE, m_handle, slot);
+  }
+
+  void TextureArrayImpl::unbind (const Index slot) const
+  {
+    if (slot >= TEXTURE_UNIT_COUNT_MAX) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to unbind texture array from invalid slot number {}!", slot);
+    }
+
+    Recorder::record(CommandType::BIND_TEXTURE, 0, slot);
+  }
+
+  void TextureArrayImpl::uploadLayer (const U32 layer, const void* data, const Size size)
+  {
+    if (data == nullptr || size == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to upload null data or zero size to texture array!");
+    }
+
+    if (layer >= m_layerCount) {
+      DG_ENGINE_THROW(std::out_of_range,
+        "Attempt to upload to out of range texture array layer {}!", layer);
+    }
+
+    Size expectedSize = (m_size.x * m_size.y * m_colorChannelCount);
+    if (size != expectedSize) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to upload data of mismatched size to texture array (expected {} bytes; got {} instead)!",
+          expectedSize, size);
+    }
+
+    Recorder::record(CommandType::UPLOAD_TEXTURE, m_handle, 0, 0, layer, 0, size);
+  }
+
+  void TextureArrayImpl::copyLayer (const U32 layer, const Texture& texture)
+  {
+    if (layer >= m_layerCount) {
+      DG_ENGINE_THROW(std::out_of_range,
+        "Attempt to copy to out of range texture array layer {}!", layer);
+    }
+
+    if (texture.isValid() == false || isCompatible(texture) == false) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to copy invalid or incompatible texture into texture array!");
+    }
+
+    Recorder::record(CommandType::COPY_TEXTURE, m_handle,
+      static_cast<const TextureImpl&>(texture).getHandle(), layer, 1);
+  }
+
+  void TextureArrayImpl::reserve (const U32 layerCount)
+  {
+    if (layerCount <= m_layerCount) { return; }
+
+    if (layerCount > MAX_LAYER_COUNT) {
+      DG_ENGINE_THROW(std::out_of_range,
+        "Attempt to grow texture array past {} layers (max is {})!", layerCount,
+          MAX_LAYER_COUNT);
+    }
+
+    // Growing the array allocates a new one and copies the old layers across on the graphics card.
+    U32 handle = Recorder::generateHandle();
+    Recorder::record(CommandType::CREATE_TEXTURE, handle, m_size.x, m_size.y,
+      m_colorChannelCount, layerCount);
+    Recorder::record(CommandType::COPY_TEXTURE, handle, m_handle, 0, m_layerCount);
+
+    m_handle = handle;
+    m_layerCount = layerCount;
+  }
+
+}
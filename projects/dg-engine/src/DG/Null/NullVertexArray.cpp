@@ -0,0 +1,61 @@
+/** @file DG/Null/NullVertexArray.cpp */
+
+#include <DG/Null/NullRecorder.hpp>
+#include <DG/Null/NullVertexArray.hpp>
+
+namespace dg
+{
+
+  Shared<VertexArray> VertexArray::make ()
+  {
+    return std::make_shared<Null::VertexArrayImpl>();
+  }
+
+}
+
+namespace dg::Null
+{
+
+  VertexArrayImpl::VertexArrayImpl () :
+    VertexArray {}
+  {
+    m_handle = Recorder::generateHandle();
+    Recorder::record(CommandType::CREATE_VERTEX_ARRAY, m_handle);
+  }
+
+  void VertexArrayImpl::bind () const
+  {
+    Recorder::record(CommandType::BIND_VERTEX_ARRAY, m_handle);
+  }
+
+  void VertexArrayImpl::unbind () const
+  {
+    Recorder::record(CommandType::BIND_VERTEX_ARRAY, 0);
+  }
+
+  void VertexArrayImpl::addVertexBuffer (const Shared<VertexBuffer>& vbo)
+  {
+    if (vbo == nullptr) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to add null vertex buffer to vertex array!");
+    }
+
+    if (vbo->getLayout().getAttributes().empty() == true) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to add vertex buffer with no layout to vertex array!");
+    }
+
+    m_vbos.push_back(vbo);
+  }
+
+  void VertexArrayImpl::setIndexBuffer (const Shared<IndexBuffer>& ibo)
+  {
+    if (ibo == nullptr) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to assign null index buffer to vertex array!");
+    }
+
+    m_ibo = ibo;
+  }
+
+}
@@ -2,6 +2,7 @@
 
 #include <DG/Graphics/RenderCommand.hpp>
 #include <DG/OpenGL/GLFrameBuffer.hpp>
+#include <DG/OpenGL/GLStateCache.hpp>
 
 namespace dg
 {
@@ -73,31 +74,49 @@ namespace dg::OpenGL
     }
   }
 
-  static void generateAttachmentTextures (U32* handles, Count count)
-  {
-    glGenTextures(count, handles);
-  }
+  /**
+   * @brief Attachment textures released by framebuffers, keyed by their format, size and sample
+   *        count, so that a framebuffer resized back to an earlier size can reuse its textures.
+   */
+  static Map<U64, Collection<U32>> s_attachmentPool;
+  static Count s_pooledAttachmentCount = 0;
+  static constexpr Count ATTACHMENT_POOL_CAPACITY = 16;
+
+  static constexpr Count FREE_READBACK_BUFFER_COUNT_MAX = 4;
 
-  static void bindAttachmentTexture (U32 handle, bool multisampled)
+  static U64 getAttachmentKey (const FrameBufferTextureFormat format, const Vector2u& size,
+    const Count sampleCount)
   {
-    glBindTexture(resolveTextureTarget(multisampled), handle);
+    return (static_cast<U64>(format) << 56) | (static_cast<U64>(sampleCount & 0xFF) << 48) |
+      (static_cast<U64>(size.x & 0xFFFFFF) << 24) | static_cast<U64>(size.y & 0xFFFFFF);
   }
 
-  static void attachColorTexture (U32 handle, Index index, 
-    const FrameBufferSpecification& framebufferSpec, 
-    const FrameBufferTextureSpecification& textureSpec)
+  static U32 acquireAttachmentTexture (const FrameBufferTextureFormat format,
+    const Vector2u& size, const Count sampleCount)
   {
-    bool multisampled = (framebufferSpec.sampleCount > 1);
+    auto iter = s_attachmentPool.find(getAttachmentKey(format, size, sampleCount));
+    if (iter != s_attachmentPool.end() && iter->second.empty() == false) {
+      U32 handle = iter->second.back();
+      iter->second.pop_back();
+      s_pooledAttachmentCount--;
+      return handle;
+    }
+
+    bool multisampled = (sampleCount > 1);
     GLenum internalFormat = 0, pixelFormat = 0, dataType = 0;
-    resolveTextureFormat(textureSpec.format, internalFormat, pixelFormat, dataType);
+    resolveTextureFormat(format, internalFormat, pixelFormat, dataType);
+
+    U32 handle = 0;
+    glGenTextures(1, &handle);
+    StateCache::bindTexture(resolveTextureTarget(multisampled), handle);
 
     if (multisampled == true) {
       glTexImage2DMultisample(
         GL_TEXTURE_2D_MULTISAMPLE,
-        framebufferSpec.sampleCount,
+        sampleCount,
         internalFormat,
-        framebufferSpec.size.x,
-        framebufferSpec.size.y,
+        size.x,
+        size.y,
         GL_FALSE
       );
     } else {
@@ -105,8 +124,8 @@ namespace dg::OpenGL
         GL_TEXTURE_2D,
         0,
         internalFormat,
-        framebufferSpec.size.x,
-        framebufferSpec.size.y,
+        size.x,
+        size.y,
         0,
         pixelFormat,
         dataType,
@@ -120,48 +139,21 @@ namespace dg::OpenGL
       glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
     }
 
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + index,
-      resolveTextureTarget(multisampled), handle, 0);
+    return handle;
   }
 
-  static void attachDepthTexture (U32 handle, const FrameBufferSpecification& framebufferSpec,
-    const FrameBufferTextureSpecification& textureSpec)
+  static void releaseAttachmentTexture (U32 handle, const FrameBufferTextureFormat format,
+    const Vector2u& size, const Count sampleCount)
   {
-    bool multisampled = (framebufferSpec.sampleCount > 1);
-    GLenum internalFormat = 0, pixelFormat = 0, dataType = 0;
-    resolveTextureFormat(textureSpec.format, internalFormat, pixelFormat, dataType);
+    if (handle == 0) { return; }
 
-    if (multisampled == true) {
-      glTexImage2DMultisample(
-        GL_TEXTURE_2D_MULTISAMPLE,
-        framebufferSpec.sampleCount,
-        internalFormat,
-        framebufferSpec.size.x,
-        framebufferSpec.size.y,
-        GL_FALSE
-      );
-    } else {
-      glTexImage2D(
-        GL_TEXTURE_2D,
-        0,
-        internalFormat,
-        framebufferSpec.size.x,
-        framebufferSpec.size.y,
-        0,
-        pixelFormat,
-        dataType,
-        nullptr
-      );
-
-      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
-      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    if (s_pooledAttachmentCount >= ATTACHMENT_POOL_CAPACITY) {
+      StateCache::deleteTexture(handle);
+      return;
     }
 
-    glFramebufferTexture2D(GL_FRAMEBUFFER, resolveAttachmentPoint(textureSpec.format),
-      resolveTextureTarget(multisampled), handle, 0);
+    s_attachmentPool[getAttachmentKey(format, size, sampleCount)].push_back(handle);
+    s_pooledAttachmentCount++;
   }
 
   FrameBufferImpl::FrameBufferImpl (const FrameBufferSpecification& spec) :
@@ -180,33 +172,68 @@ namespace dg::OpenGL
 
   FrameBufferImpl::~FrameBufferImpl ()
   {
-    if (m_handle == 0) {
-      glDeleteFramebuffers(1, &m_handle);
-      glDeleteTextures(m_colorHandles.size(), m_colorHandles.data());
-      glDeleteTextures(1, &m_depthHandle);
+    for (const auto& pending : m_readbacks) {
+      glDeleteSync(pending.fence);
+      StateCache::deleteBuffer(pending.buffer);
+    }
+
+    for (const auto& free : m_freeReadbackBuffers) {
+      StateCache::deleteBuffer(free.buffer);
+    }
 
-      m_colorHandles.clear();
-      m_depthHandle = 0;
+    if (m_handle != 0) {
+      releaseAttachments();
+      StateCache::deleteFrameBuffer(m_handle);
       m_handle = 0;
     }
   }
 
+  void FrameBufferImpl::clearAttachmentPool ()
+  {
+    for (const auto& [key, handles] : s_attachmentPool) {
+      for (U32 handle : handles) { StateCache::deleteTexture(handle); }
+    }
+
+    s_attachmentPool.clear();
+    s_pooledAttachmentCount = 0;
+  }
+
   void FrameBufferImpl::bind (FrameBufferBindTarget target) const
   {
-    glBindFramebuffer(resolveBindTarget(target), m_handle);
+    StateCache::bindFrameBuffer(resolveBindTarget(target), m_handle);
 
     if (
       target == FrameBufferBindTarget::DRAW ||
       target == FrameBufferBindTarget::BOTH
     ) {
-      RenderCommand::setViewport(m_spec.size.x, m_spec.size.y);
+      // The viewport being replaced is restored on unbinding. Under a bucketed resize policy or a
+      // reduced render scale, the attachments may be larger than the region drawn into, which is
+      // their lower-left corner.
+      if (m_viewportSaved == false) {
+        StateCache::getViewport(m_previousViewport);
+        m_viewportSaved = true;
+      }
+
+      Vector2u renderSize = getRenderSize();
+      RenderCommand::setViewport(renderSize.x, renderSize.y);
       RenderCommand::clear();
     }
   }
 
   void FrameBufferImpl::unbind (FrameBufferBindTarget target) const
   {
-    glBindFramebuffer(resolveBindTarget(target), 0);
+    StateCache::bindFrameBuffer(resolveBindTarget(target), 0);
+
+    if (
+      m_viewportSaved == true && (
+        target == FrameBufferBindTarget::DRAW ||
+        target == FrameBufferBindTarget::BOTH
+      )
+    ) {
+      RenderCommand::setViewport(m_previousViewport[0], m_previousViewport[1],
+        m_previousViewport[2], m_previousViewport[3]);
+      m_viewportSaved = false;
+    }
   }
 
   U32 FrameBufferImpl::getColorHandle (const Index index) const
@@ -251,10 +278,12 @@ namespace dg::OpenGL
     resolveTextureFormat(textureSpec.format, internalFormat, pixelFormat, pixelDataType);
 
     I32 pixelData = 0;
-    glBindFramebuffer(GL_READ_FRAMEBUFFER, m_handle);
+    Vector2i renderPosition = getRenderPosition(position);
+    StateCache::bindFrameBuffer(GL_READ_FRAMEBUFFER, m_handle);
     glReadBuffer(GL_COLOR_ATTACHMENT0 + index);
-    glReadPixels(position.x, position.y, 1, 1, pixelFormat, pixelDataType, &pixelData);
-    glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+    glReadPixels(renderPosition.x, renderPosition.y, 1, 1, pixelFormat, pixelDataType,
+      &pixelData);
+    StateCache::bindFrameBuffer(GL_READ_FRAMEBUFFER, 0);
 
     return pixelData;
   }
@@ -264,41 +293,121 @@ namespace dg::OpenGL
     return readPixelI32(index, position.cast<I32>());
   }
 
-  void FrameBufferImpl::onSizeChanged ()
+  bool FrameBufferImpl::pollReadbacks (const bool wait)
+  {
+    // The graphics card finishes readbacks in the order they were requested, so there is no need to
+    // look past the first one which is not done yet.
+    while (m_readbacks.empty() == false) {
+      PendingReadback pending = m_readbacks.front();
+      GLenum result = glClientWaitSync(pending.fence, GL_SYNC_FLUSH_COMMANDS_BIT,
+        (wait == true) ? 1000000000 : 0);
+      if (result == GL_TIMEOUT_EXPIRED) {
+        if (wait == true) { continue; }
+        break;
+      }
+
+      m_readbacks.pop_front();
+      glDeleteSync(pending.fence);
+
+      FrameBufferReadback& readback = *pending.readback;
+      if (result == GL_WAIT_FAILED) {
+        DG_ENGINE_ERROR("Error waiting on fence for GL framebuffer readback!");
+      } else {
+        readback.values.resize(readback.size.x * readback.size.y);
+        glGetNamedBufferSubData(pending.buffer, 0, readback.values.size() * sizeof(I32),
+          readback.values.data());
+      }
+
+      if (m_freeReadbackBuffers.size() < FREE_READBACK_BUFFER_COUNT_MAX) {
+        m_freeReadbackBuffers.push_back({ nullptr, pending.buffer, pending.bufferSize, nullptr });
+      } else {
+        StateCache::deleteBuffer(pending.buffer);
+      }
+
+      finishReadback(readback);
+    }
+
+    return m_readbacks.empty();
+  }
+
+  void FrameBufferImpl::beginReadback (const Shared<FrameBufferReadback>& readback)
+  {
+    PendingReadback pending;
+    pending.readback = readback;
+
+    // Reuse a free buffer large enough for the region, if there is one.
+    Size size = readback->size.x * readback->size.y * sizeof(I32);
+    auto iter = std::find_if(m_freeReadbackBuffers.begin(), m_freeReadbackBuffers.end(),
+      [size] (const PendingReadback& free) { return free.bufferSize >= size; });
+    if (iter != m_freeReadbackBuffers.end()) {
+      pending.buffer = iter->buffer;
+      pending.bufferSize = iter->bufferSize;
+      m_freeReadbackBuffers.erase(iter);
+    } else {
+      glCreateBuffers(1, &pending.buffer);
+      glNamedBufferData(pending.buffer, size, nullptr, GL_STREAM_READ);
+      pending.bufferSize = size;
+    }
+
+    StateCache::bindFrameBuffer(GL_READ_FRAMEBUFFER, m_handle);
+    StateCache::bindBuffer(GL_PIXEL_PACK_BUFFER, pending.buffer);
+    glReadBuffer(GL_COLOR_ATTACHMENT0 + readback->attachmentIndex);
+    glReadPixels(readback->offset.x, readback->offset.y, readback->size.x, readback->size.y,
+      GL_RED_INTEGER, GL_INT, nullptr);
+    StateCache::bindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    StateCache::bindFrameBuffer(GL_READ_FRAMEBUFFER, 0);
+
+    pending.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    m_readbacks.push_back(pending);
+  }
+
+  void FrameBufferImpl::onAllocatedSizeChanged ()
   {
     build();
   }
 
+  void FrameBufferImpl::releaseAttachments ()
+  {
+    for (Index i = 0; i < m_colorHandles.size(); ++i) {
+      releaseAttachmentTexture(m_colorHandles.at(i), m_colorAttachmentSpecs.at(i).format,
+        m_builtSize, m_spec.sampleCount);
+    }
+
+    releaseAttachmentTexture(m_depthHandle, m_depthAttachmentSpec.format, m_builtSize,
+      m_spec.sampleCount);
+
+    m_colorHandles.clear();
+    m_depthHandle = 0;
+  }
+
   void FrameBufferImpl::build ()
   {
+    // The framebuffer object itself outlives its attachments, which go back to the pool when they
+    // are replaced.
     if (m_handle == 0) {
-      glDeleteFramebuffers(1, &m_handle);
-      glDeleteTextures(m_colorHandles.size(), m_colorHandles.data());
-      glDeleteTextures(1, &m_depthHandle);
-
-      m_colorHandles.clear();
-      m_depthHandle = 0;
-      m_handle = 0;
+      glCreateFramebuffers(1, &m_handle);
+    } else {
+      releaseAttachments();
     }
 
-    glCreateFramebuffers(1, &m_handle);
-    glBindFramebuffer(GL_FRAMEBUFFER, m_handle);
+    StateCache::bindFrameBuffer(GL_FRAMEBUFFER, m_handle);
 
     bool multisampled = (m_spec.sampleCount > 1);
-    if (m_colorAttachmentSpecs.empty() == false) {
-      m_colorHandles.resize(m_colorAttachmentSpecs.size());
-      generateAttachmentTextures(m_colorHandles.data(), m_colorHandles.size());
-
-      for (Index i = 0; i < m_colorAttachmentSpecs.size(); ++i) {
-        bindAttachmentTexture(m_colorHandles.at(i), multisampled);
-        attachColorTexture(m_colorHandles.at(i), i, m_spec, m_colorAttachmentSpecs.at(i));
-      }
+    m_builtSize = m_allocatedSize;
+
+    m_colorHandles.resize(m_colorAttachmentSpecs.size());
+    for (Index i = 0; i < m_colorAttachmentSpecs.size(); ++i) {
+      m_colorHandles.at(i) = acquireAttachmentTexture(m_colorAttachmentSpecs.at(i).format,
+        m_builtSize, m_spec.sampleCount);
+      glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + i,
+        resolveTextureTarget(multisampled), m_colorHandles.at(i), 0);
     }
 
     if (m_depthAttachmentSpec.format != FrameBufferTextureFormat::NONE) {
-      generateAttachmentTextures(&m_depthHandle, 1);
-      bindAttachmentTexture(m_depthHandle, multisampled);
-      attachDepthTexture(m_depthHandle, m_spec, m_depthAttachmentSpec);
+      m_depthHandle = acquireAttachmentTexture(m_depthAttachmentSpec.format, m_builtSize,
+        m_spec.sampleCount);
+      glFramebufferTexture2D(GL_FRAMEBUFFER, resolveAttachmentPoint(m_depthAttachmentSpec.format),
+        resolveTextureTarget(multisampled), m_depthHandle, 0);
     }
 
     if (m_colorHandles.empty() == false) {
@@ -324,7 +433,7 @@ namespace dg::OpenGL
       DG_ENGINE_THROW(std::runtime_error, "Error building complete GL framebuffer!");
     }
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    StateCache::bindFrameBuffer(GL_FRAMEBUFFER, 0);
   }
 
 }
@@ -0,0 +1,150 @@
+/** @file DG/OpenGL/GLGpuTimer.cpp */
+
+#include <DG/OpenGL/GLGpuTimer.hpp>
+
+namespace dg
+{
+
+  Unique<GpuTimer> GpuTimer::make (const Count latency)
+  {
+    return std::make_unique<OpenGL::GpuTimerImpl>(latency);
+  }
+
+}
+
+namespace dg::OpenGL
+{
+
+  GpuTimerImpl::GpuTimerImpl (const Count latency) :
+    GpuTimer {}
+  {
+    if (latency == 0) {
+      DG_ENGINE_THROW(std::invalid_argument, "Attempt to create GPU timer with zero latency!");
+    }
+
+    m_frames.resize(latency);
+    for (auto& frame : m_frames) {
+      glGenQueries(1, &frame.beginQuery);
+      glGenQueries(1, &frame.endQuery);
+    }
+  }
+
+  GpuTimerImpl::~GpuTimerImpl ()
+  {
+    for (auto& frame : m_frames) {
+      glDeleteQueries(1, &frame.beginQuery);
+      glDeleteQueries(1, &frame.endQuery);
+      glDeleteQueries(frame.rangeQueries.size(), frame.rangeQueries.data());
+    }
+  }
+
+  void GpuTimerImpl::beginFrame ()
+  {
+    if (m_frameStarted == true) {
+      DG_ENGINE_THROW(std::runtime_error,
+        "Attempt to begin GPU timer frame when one is already started!");
+    }
+
+    // The frame about to be reused was issued a full ring ago, so its results are read first.
+    m_current = (m_current + 1) % m_frames.size();
+    GpuTimerFrame& frame = m_frames[m_current];
+    m_hasNewResults = false;
+    if (frame.pending == true) {
+      readFrame(frame);
+    }
+
+    glQueryCounter(frame.beginQuery, GL_TIMESTAMP);
+    frame.rangeCount = 0;
+    m_frameStarted = true;
+  }
+
+  void GpuTimerImpl::endFrame ()
+  {
+    if (m_frameStarted == false) {
+      DG_ENGINE_THROW(std::runtime_error,
+        "Attempt to end GPU timer frame when no such frame was started!");
+    }
+
+    if (m_rangeStarted == true) {
+      endRange();
+    }
+
+    GpuTimerFrame& frame = m_frames[m_current];
+    glQueryCounter(frame.endQuery, GL_TIMESTAMP);
+    frame.pending = true;
+    m_frameStarted = false;
+  }
+
+  void GpuTimerImpl::beginRange ()
+  {
+    if (m_frameStarted == false || m_rangeStarted == true) {
+      DG_ENGINE_THROW(std::runtime_error,
+        "Attempt to begin GPU timer range outside of a frame, or inside another range!");
+    }
+
+    GpuTimerFrame& frame = m_frames[m_current];
+    if (frame.rangeCount == frame.rangeQueries.size()) {
+      U32 query = 0;
+      glGenQueries(1, &query);
+      frame.rangeQueries.push_back(query);
+    }
+
+    glBeginQuery(GL_TIME_ELAPSED, frame.rangeQueries[frame.rangeCount++]);
+    m_rangeStarted = true;
+  }
+
+  void GpuTimerImpl::endRange ()
+  {
+    if (m_rangeStarted == false) {
+      DG_ENGINE_THROW(std::runtime_error,
+        "Attempt to end GPU timer range when no such range was started!");
+    }
+
+    glEndQuery(GL_TIME_ELAPSED);
+    m_rangeStarted = false;
+  }
+
+  Count GpuTimerImpl::getLatency () const
+  {
+    return m_frames.size();
+  }
+
+  void GpuTimerImpl::readFrame (GpuTimerFrame& frame)
+  {
+    frame.pending = false;
+
+    // Asking for a result which is not yet available would stall until it is, so the frame is
+    // discarded instead if any of its queries are still outstanding.
+    auto isAvailable = [] (U32 query) {
+      GLint available = GL_FALSE;
+      glGetQueryObjectiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+      return available == GL_TRUE;
+    };
+
+    bool available = isAvailable(frame.endQuery);
+    for (Index i = 0; i < frame.rangeCount && available == true; ++i) {
+      available = isAvailable(frame.rangeQueries[i]);
+    }
+
+    if (available == false) {
+      m_discardedFrameCount++;
+      return;
+    }
+
+    GLuint64 begin = 0, end = 0;
+    glGetQueryObjectui64v(frame.beginQuery, GL_QUERY_RESULT, &begin);
+    glGetQueryObjectui64v(frame.endQuery, GL_QUERY_RESULT, &end);
+    m_frameTime = (end - begin) / 1'000'000.0;
+
+    m_rangeTimes.resize(frame.rangeCount);
+    for (Index i = 0; i < frame.rangeCount; ++i) {
+      GLuint64 elapsed = 0;
+      glGetQueryObjectui64v(frame.rangeQueries[i], GL_QUERY_RESULT, &elapsed);
+      m_rangeTimes[i] = elapsed / 1'000'000.0;
+    }
+
+    m_hasResults = true;
+    m_hasNewResults = true;
+  }
+
+}
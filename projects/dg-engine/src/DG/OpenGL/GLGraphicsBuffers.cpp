@@ -1,6 +1,7 @@
 /** @file DG/OpenGL/GLGraphicsBuffers.cpp */
 
 #include <DG/OpenGL/GLGraphicsBuffers.hpp>
+#include <DG/OpenGL/GLStateCache.hpp>
 
 namespace dg
 {
@@ -15,6 +16,12 @@ namespace dg
     return std::make_shared<OpenGL::VertexBufferImpl>(size);
   }
 
+  Shared<StreamingVertexBuffer> StreamingVertexBuffer::make (const Size regionSize,
+    const Count regionCount)
+  {
+    return std::make_shared<OpenGL::StreamingVertexBufferImpl>(regionSize, regionCount);
+  }
+
   Shared<IndexBuffer> IndexBuffer::make (const Collection<U32>& indices, bool dynamic)
   {
     return std::make_shared<OpenGL::IndexBufferImpl>(indices, dynamic);
@@ -25,11 +32,67 @@ namespace dg
     return std::make_shared<OpenGL::IndexBufferImpl>(count);
   }
 
+  Shared<IndirectBuffer> IndirectBuffer::allocate (const Count commandCount)
+  {
+    return std::make_shared<OpenGL::IndirectBufferImpl>(commandCount);
+  }
+
+  Shared<StreamingIndirectBuffer> StreamingIndirectBuffer::make (const Count regionCommandCount,
+    const Count regionCount)
+  {
+    return std::make_shared<OpenGL::StreamingIndirectBufferImpl>(regionCommandCount, regionCount);
+  }
+
+  Shared<StorageBuffer> StorageBuffer::allocate (const Size size)
+  {
+    return std::make_shared<OpenGL::StorageBufferImpl>(size);
+  }
+
+  Shared<StreamingStorageBuffer> StreamingStorageBuffer::make (const Size regionSize,
+    const Count regionCount)
+  {
+    return std::make_shared<OpenGL::StreamingStorageBufferImpl>(regionSize, regionCount);
+  }
+
+  Shared<UniformBuffer> UniformBuffer::allocate (const Size size)
+  {
+    return std::make_shared<OpenGL::UniformBufferImpl>(size);
+  }
+
+  Shared<PixelUploadBuffer> PixelUploadBuffer::make (const Size regionSize,
+    const Count regionCount)
+  {
+    return std::make_shared<OpenGL::PixelUploadBufferImpl>(regionSize, regionCount);
+  }
+
 }
 
 namespace dg::OpenGL
 {
 
+  /**
+   * @brief Blocks until the graphics card has finished with the commands which last read from a
+   *        streaming buffer's region, as fenced when the region was released. With enough regions
+   *        in the ring, this fence has long since been signaled.
+   */
+  static void waitForRegionFence (GLsync& fence, const Char* bufferName, const Index region)
+  {
+    if (fence == nullptr) { return; }
+
+    GLenum result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+    while (result == GL_TIMEOUT_EXPIRED) {
+      result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+    }
+
+    glDeleteSync(fence);
+    fence = nullptr;
+
+    if (result == GL_WAIT_FAILED) {
+      DG_ENGINE_THROW(std::runtime_error,
+        "Error waiting on fence for GL {} region {}!", bufferName, region);
+    }
+  }
+
   VertexBufferImpl::VertexBufferImpl (const void* data, const Size size, bool dynamic) :
     VertexBuffer {}
   {
@@ -39,7 +102,7 @@ namespace dg::OpenGL
     }
 
     glGenBuffers(1, &m_handle);
-    glBindBuffer(GL_ARRAY_BUFFER, m_handle);
+    StateCache::bindBuffer(GL_ARRAY_BUFFER, m_handle);
     glBufferData(GL_ARRAY_BUFFER, size, data, (dynamic == true) ? GL_DYNAMIC_DRAW :
       GL_STATIC_DRAW);
 
@@ -56,7 +119,7 @@ namespace dg::OpenGL
     }
 
     glGenBuffers(1, &m_handle);
-    glBindBuffer(GL_ARRAY_BUFFER, m_handle);
+    StateCache::bindBuffer(GL_ARRAY_BUFFER, m_handle);
     glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
 
     m_dynamic = true;
@@ -65,17 +128,17 @@ namespace dg::OpenGL
 
   VertexBufferImpl::~VertexBufferImpl ()
   {
-    glDeleteBuffers(1, &m_handle);
+    StateCache::deleteBuffer(m_handle);
   }
 
   void VertexBufferImpl::bind () const
   {
-    glBindBuffer(GL_ARRAY_BUFFER, m_handle);
+    StateCache::bindBuffer(GL_ARRAY_BUFFER, m_handle);
   }
 
   void VertexBufferImpl::unbind () const
   {
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    StateCache::bindBuffer(GL_ARRAY_BUFFER, 0);
   }
 
   void VertexBufferImpl::upload (const void* data, const Size size)
@@ -90,10 +153,146 @@ namespace dg::OpenGL
         "Attempt to upload null data or zero size to GL vertex buffer!");
     }
 
-    glBindBuffer(GL_ARRAY_BUFFER, m_handle);
+    if (size > m_byteSize) {
+      DG_ENGINE_THROW(std::out_of_range,
+        "Attempt to upload {} bytes to GL vertex buffer of {} bytes!", size, m_byteSize);
+    }
+
+    StateCache::bindBuffer(GL_ARRAY_BUFFER, m_handle);
     glBufferSubData(GL_ARRAY_BUFFER, 0, size, data);
   }
 
+  void VertexBufferImpl::uploadRange (const void* data, const Size size, const Size offset)
+  {
+    if (m_dynamic == false) {
+      DG_ENGINE_THROW(std::runtime_error,
+        "Attempt to upload dynamic vertex data to non-dynamic GL vertex buffer!");
+    }
+
+    if (data == nullptr || size == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to upload null data or zero size to GL vertex buffer!");
+    }
+
+    if (offset + size > m_byteSize) {
+      DG_ENGINE_THROW(std::out_of_range,
+        "Attempt to upload {} bytes at offset {} to GL vertex buffer of {} bytes!", size, offset,
+          m_byteSize);
+    }
+
+    StateCache::bindBuffer(GL_ARRAY_BUFFER, m_handle);
+    glBufferSubData(GL_ARRAY_BUFFER, offset, size, data);
+  }
+
+
+
+  StreamingVertexBufferImpl::StreamingVertexBufferImpl (const Size regionSize,
+    const Count regionCount) :
+    StreamingVertexBuffer {}
+  {
+    if (regionSize == 0 || regionCount == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to allocate GL streaming vertex buffer with zero region size or count!");
+    }
+
+    // The buffer's storage is immutable and stays mapped for its whole lifetime. Coherent mapping
+    // means writes through the mapping become visible to the GL without an explicit flush.
+    GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    Size byteSize = regionSize * regionCount;
+
+    glGenBuffers(1, &m_handle);
+    StateCache::bindBuffer(GL_ARRAY_BUFFER, m_handle);
+    glBufferStorage(GL_ARRAY_BUFFER, byteSize, nullptr, flags);
+    m_mapping = static_cast<U8*>(glMapBufferRange(GL_ARRAY_BUFFER, 0, byteSize, flags));
+    if (m_mapping == nullptr) {
+      StateCache::deleteBuffer(m_handle);
+      DG_ENGINE_THROW(std::runtime_error,
+        "Could not persistently map GL streaming vertex buffer of {} bytes!", byteSize);
+    }
+
+    m_fences.resize(regionCount, nullptr);
+    m_dynamic = true;
+    m_byteSize = byteSize;
+    m_regionSize = regionSize;
+    m_regionCount = regionCount;
+  }
+
+  StreamingVertexBufferImpl::~StreamingVertexBufferImpl ()
+  {
+    for (GLsync fence : m_fences) {
+      if (fence != nullptr) { glDeleteSync(fence); }
+    }
+
+    StateCache::bindBuffer(GL_ARRAY_BUFFER, m_handle);
+    glUnmapBuffer(GL_ARRAY_BUFFER);
+    StateCache::deleteBuffer(m_handle);
+  }
+
+  void StreamingVertexBufferImpl::bind () const
+  {
+    StateCache::bindBuffer(GL_ARRAY_BUFFER, m_handle);
+  }
+
+  void StreamingVertexBufferImpl::unbind () const
+  {
+    StateCache::bindBuffer(GL_ARRAY_BUFFER, 0);
+  }
+
+  void StreamingVertexBufferImpl::upload (const void* data, const Size size)
+  {
+    if (data == nullptr || size == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to upload null data or zero size to GL streaming vertex buffer!");
+    }
+
+    if (size > m_regionSize) {
+      DG_ENGINE_THROW(std::out_of_range,
+        "Attempt to upload {} bytes to GL streaming vertex buffer region of {} bytes!",
+          size, m_regionSize);
+    }
+
+    std::memcpy(acquireRegion(), data, size);
+  }
+
+  void StreamingVertexBufferImpl::uploadRange (const void* data, const Size size,
+    const Size offset)
+  {
+    if (data == nullptr || size == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to upload null data or zero size to GL streaming vertex buffer!");
+    }
+
+    if (offset + size > m_regionSize) {
+      DG_ENGINE_THROW(std::out_of_range,
+        "Attempt to upload {} bytes at offset {} to GL streaming vertex buffer region of {} bytes!",
+          size, offset, m_regionSize);
+    }
+
+    std::memcpy(static_cast<U8*>(acquireRegion()) + offset, data, size);
+  }
+
+  void* StreamingVertexBufferImpl::acquireRegion ()
+  {
+    if (m_regionAcquired == false) {
+      waitForRegionFence(m_fences.at(m_regionIndex), "streaming vertex buffer", m_regionIndex);
+      m_regionAcquired = true;
+    }
+
+    return m_mapping + getRegionOffset();
+  }
+
+  void StreamingVertexBufferImpl::releaseRegion ()
+  {
+    if (m_regionAcquired == false) {
+      DG_ENGINE_THROW(std::runtime_error,
+        "Attempt to release unacquired GL streaming vertex buffer region {}!", m_regionIndex);
+    }
+
+    m_fences.at(m_regionIndex) = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    m_regionIndex = (m_regionIndex + 1) % m_regionCount;
+    m_regionAcquired = false;
+  }
+
 
 
   IndexBufferImpl::IndexBufferImpl (const Collection<U32>& indices, bool dynamic) :
@@ -105,7 +304,7 @@ namespace dg::OpenGL
     }
 
     glGenBuffers(1, &m_handle);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_handle);
+    StateCache::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_handle);
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(U32), indices.data(),
       (dynamic == true) ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
     
@@ -122,7 +321,7 @@ namespace dg::OpenGL
     }
 
     glGenBuffers(1, &m_handle);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_handle);
+    StateCache::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_handle);
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(U32), nullptr, GL_DYNAMIC_DRAW);
 
     m_dynamic = true;
@@ -131,17 +330,414 @@ namespace dg::OpenGL
 
   IndexBufferImpl::~IndexBufferImpl ()
   {
-    glDeleteBuffers(1, &m_handle);
+    StateCache::deleteBuffer(m_handle);
   }
 
   void IndexBufferImpl::bind () const
   {
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_handle);
+    StateCache::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_handle);
   }
 
   void IndexBufferImpl::unbind () const
   {
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    StateCache::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+  }
+
+
+
+  IndirectBufferImpl::IndirectBufferImpl (const Count commandCount) :
+    IndirectBuffer {}
+  {
+    if (commandCount == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to allocate GL indirect buffer with zero command count!");
+    }
+
+    glGenBuffers(1, &m_handle);
+    StateCache::bindBuffer(GL_DRAW_INDIRECT_BUFFER, m_handle);
+    glBufferData(GL_DRAW_INDIRECT_BUFFER, commandCount * sizeof(DrawIndexedIndirectCommand),
+      nullptr, GL_DYNAMIC_DRAW);
+
+    m_commandCount = commandCount;
+  }
+
+  IndirectBufferImpl::~IndirectBufferImpl ()
+  {
+    StateCache::deleteBuffer(m_handle);
+  }
+
+  void IndirectBufferImpl::bind () const
+  {
+    StateCache::bindBuffer(GL_DRAW_INDIRECT_BUFFER, m_handle);
+  }
+
+  void IndirectBufferImpl::unbind () const
+  {
+    StateCache::bindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+  }
+
+  void IndirectBufferImpl::upload (const DrawIndexedIndirectCommand* commands, const Count count)
+  {
+    if (commands == nullptr || count == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to upload null or zero commands to GL indirect buffer!");
+    }
+
+    if (count > m_commandCount) {
+      DG_ENGINE_THROW(std::out_of_range,
+        "Attempt to upload {} commands to GL indirect buffer of {} commands!", count,
+          m_commandCount);
+    }
+
+    StateCache::bindBuffer(GL_DRAW_INDIRECT_BUFFER, m_handle);
+    glBufferSubData(GL_DRAW_INDIRECT_BUFFER, 0, count * sizeof(DrawIndexedIndirectCommand),
+      commands);
+  }
+
+
+
+  StreamingIndirectBufferImpl::StreamingIndirectBufferImpl (const Count regionCommandCount,
+    const Count regionCount) :
+    StreamingIndirectBuffer {}
+  {
+    if (regionCommandCount == 0 || regionCount == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to allocate GL streaming indirect buffer with zero region size or count!");
+    }
+
+    // As with the streaming vertex buffer, the storage is immutable, and stays coherently mapped
+    // for the buffer's whole lifetime.
+    GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    Count commandCount = regionCommandCount * regionCount;
+    Size byteSize = commandCount * sizeof(DrawIndexedIndirectCommand);
+
+    glGenBuffers(1, &m_handle);
+    StateCache::bindBuffer(GL_DRAW_INDIRECT_BUFFER, m_handle);
+    glBufferStorage(GL_DRAW_INDIRECT_BUFFER, byteSize, nullptr, flags);
+    m_mapping = static_cast<DrawIndexedIndirectCommand*>(
+      glMapBufferRange(GL_DRAW_INDIRECT_BUFFER, 0, byteSize, flags));
+    if (m_mapping == nullptr) {
+      StateCache::deleteBuffer(m_handle);
+      DG_ENGINE_THROW(std::runtime_error,
+        "Could not persistently map GL streaming indirect buffer of {} bytes!", byteSize);
+    }
+
+    m_fences.resize(regionCount, nullptr);
+    m_commandCount = commandCount;
+    m_regionCommandCount = regionCommandCount;
+    m_regionCount = regionCount;
+  }
+
+  StreamingIndirectBufferImpl::~StreamingIndirectBufferImpl ()
+  {
+    for (GLsync fence : m_fences) {
+      if (fence != nullptr) { glDeleteSync(fence); }
+    }
+
+    StateCache::bindBuffer(GL_DRAW_INDIRECT_BUFFER, m_handle);
+    glUnmapBuffer(GL_DRAW_INDIRECT_BUFFER);
+    StateCache::deleteBuffer(m_handle);
+  }
+
+  void StreamingIndirectBufferImpl::bind () const
+  {
+    StateCache::bindBuffer(GL_DRAW_INDIRECT_BUFFER, m_handle);
+  }
+
+  void StreamingIndirectBufferImpl::unbind () const
+  {
+    StateCache::bindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+  }
+
+  void StreamingIndirectBufferImpl::upload (const DrawIndexedIndirectCommand* commands,
+    const Count count)
+  {
+    if (commands == nullptr || count == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to upload null or zero commands to GL streaming indirect buffer!");
+    }
+
+    if (count > m_regionCommandCount) {
+      DG_ENGINE_THROW(std::out_of_range,
+        "Attempt to upload {} commands to GL streaming indirect buffer region of {} commands!",
+          count, m_regionCommandCount);
+    }
+
+    std::memcpy(acquireRegion(), commands, count * sizeof(DrawIndexedIndirectCommand));
+  }
+
+  DrawIndexedIndirectCommand* StreamingIndirectBufferImpl::acquireRegion ()
+  {
+    if (m_regionAcquired == false) {
+      waitForRegionFence(m_fences.at(m_regionIndex), "streaming indirect buffer", m_regionIndex);
+      m_regionAcquired = true;
+    }
+
+    return m_mapping + getRegionFirstCommand();
+  }
+
+  void StreamingIndirectBufferImpl::releaseRegion ()
+  {
+    if (m_regionAcquired == false) {
+      DG_ENGINE_THROW(std::runtime_error,
+        "Attempt to release unacquired GL streaming indirect buffer region {}!", m_regionIndex);
+    }
+
+    m_fences.at(m_regionIndex) = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    m_regionIndex = (m_regionIndex + 1) % m_regionCount;
+    m_regionAcquired = false;
+  }
+
+
+
+  StorageBufferImpl::StorageBufferImpl (const Size size) :
+    StorageBuffer {}
+  {
+    if (size == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to allocate GL storage buffer with zero size!");
+    }
+
+    glGenBuffers(1, &m_handle);
+    StateCache::bindBuffer(GL_SHADER_STORAGE_BUFFER, m_handle);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+
+    m_byteSize = size;
+  }
+
+  StorageBufferImpl::~StorageBufferImpl ()
+  {
+    StateCache::deleteBuffer(m_handle);
+  }
+
+  void StorageBufferImpl::bind (const Index binding) const
+  {
+    StateCache::bindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, m_handle);
+  }
+
+  void StorageBufferImpl::unbind (const Index binding) const
+  {
+    StateCache::bindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, 0);
+  }
+
+  void StorageBufferImpl::upload (const void* data, const Size size)
+  {
+    if (data == nullptr || size == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to upload null data or zero size to GL storage buffer!");
+    }
+
+    if (size > m_byteSize) {
+      DG_ENGINE_THROW(std::out_of_range,
+        "Attempt to upload {} bytes to GL storage buffer of {} bytes!", size, m_byteSize);
+    }
+
+    StateCache::bindBuffer(GL_SHADER_STORAGE_BUFFER, m_handle);
+    glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, size, data);
+  }
+
+
+
+  StreamingStorageBufferImpl::StreamingStorageBufferImpl (const Size regionSize,
+    const Count regionCount) :
+    StreamingStorageBuffer {}
+  {
+    if (regionSize == 0 || regionCount == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to allocate GL streaming storage buffer with zero region size or count!");
+    }
+
+    // As with the streaming vertex buffer, the storage is immutable, and stays coherently mapped
+    // for the buffer's whole lifetime.
+    GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    Size byteSize = regionSize * regionCount;
+
+    glGenBuffers(1, &m_handle);
+    StateCache::bindBuffer(GL_SHADER_STORAGE_BUFFER, m_handle);
+    glBufferStorage(GL_SHADER_STORAGE_BUFFER, byteSize, nullptr, flags);
+    m_mapping = static_cast<U8*>(glMapBufferRange(GL_SHADER_STORAGE_BUFFER, 0, byteSize, flags));
+    if (m_mapping == nullptr) {
+      StateCache::deleteBuffer(m_handle);
+      DG_ENGINE_THROW(std::runtime_error,
+        "Could not persistently map GL streaming storage buffer of {} bytes!", byteSize);
+    }
+
+    m_fences.resize(regionCount, nullptr);
+    m_byteSize = byteSize;
+    m_regionSize = regionSize;
+    m_regionCount = regionCount;
+  }
+
+  StreamingStorageBufferImpl::~StreamingStorageBufferImpl ()
+  {
+    for (GLsync fence : m_fences) {
+      if (fence != nullptr) { glDeleteSync(fence); }
+    }
+
+    StateCache::bindBuffer(GL_SHADER_STORAGE_BUFFER, m_handle);
+    glUnmapBuffer(GL_SHADER_STORAGE_BUFFER);
+    StateCache::deleteBuffer(m_handle);
+  }
+
+  void StreamingStorageBufferImpl::bind (const Index binding) const
+  {
+    StateCache::bindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, m_handle);
+  }
+
+  void StreamingStorageBufferImpl::unbind (const Index binding) const
+  {
+    StateCache::bindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, 0);
+  }
+
+  void StreamingStorageBufferImpl::upload (const void* data, const Size size)
+  {
+    if (data == nullptr || size == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to upload null data or zero size to GL streaming storage buffer!");
+    }
+
+    if (size > m_regionSize) {
+      DG_ENGINE_THROW(std::out_of_range,
+        "Attempt to upload {} bytes to GL streaming storage buffer region of {} bytes!", size,
+          m_regionSize);
+    }
+
+    std::memcpy(acquireRegion(), data, size);
+  }
+
+  void* StreamingStorageBufferImpl::acquireRegion ()
+  {
+    if (m_regionAcquired == false) {
+      waitForRegionFence(m_fences.at(m_regionIndex), "streaming storage buffer", m_regionIndex);
+      m_regionAcquired = true;
+    }
+
+    return m_mapping + getRegionOffset();
+  }
+
+  void StreamingStorageBufferImpl::releaseRegion ()
+  {
+    if (m_regionAcquired == false) {
+      DG_ENGINE_THROW(std::runtime_error,
+        "Attempt to release unacquired GL streaming storage buffer region {}!", m_regionIndex);
+    }
+
+    m_fences.at(m_regionIndex) = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    m_regionIndex = (m_regionIndex + 1) % m_regionCount;
+    m_regionAcquired = false;
+  }
+
+
+
+  UniformBufferImpl::UniformBufferImpl (const Size size) :
+    UniformBuffer {}
+  {
+    if (size == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to allocate GL uniform buffer with zero size!");
+    }
+
+    glGenBuffers(1, &m_handle);
+    StateCache::bindBuffer(GL_UNIFORM_BUFFER, m_handle);
+    glBufferData(GL_UNIFORM_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+
+    m_byteSize = size;
+  }
+
+  UniformBufferImpl::~UniformBufferImpl ()
+  {
+    StateCache::deleteBuffer(m_handle);
+  }
+
+  void UniformBufferImpl::bind (const Index binding) const
+  {
+    StateCache::bindBufferBase(GL_UNIFORM_BUFFER, binding, m_handle);
+  }
+
+  void UniformBufferImpl::unbind (const Index binding) const
+  {
+    StateCache::bindBufferBase(GL_UNIFORM_BUFFER, binding, 0);
+  }
+
+  void UniformBufferImpl::upload (const void* data, const Size size)
+  {
+    if (data == nullptr || size == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to upload null data or zero size to GL uniform buffer!");
+    }
+
+    if (size > m_byteSize) {
+      DG_ENGINE_THROW(std::out_of_range,
+        "Attempt to upload {} bytes to GL uniform buffer of {} bytes!", size, m_byteSize);
+    }
+
+    StateCache::bindBuffer(GL_UNIFORM_BUFFER, m_handle);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, size, data);
+  }
+
+
+
+  PixelUploadBufferImpl::PixelUploadBufferImpl (const Size regionSize, const Count regionCount) :
+    PixelUploadBuffer {}
+  {
+    if (regionSize == 0 || regionCount == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to allocate GL pixel upload buffer with zero region size or count!");
+    }
+
+    // As with the streaming vertex buffer, the storage is immutable, and stays coherently mapped
+    // for the buffer's whole lifetime.
+    GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    Size byteSize = regionSize * regionCount;
+
+    glGenBuffers(1, &m_handle);
+    StateCache::bindBuffer(GL_PIXEL_UNPACK_BUFFER, m_handle);
+    glBufferStorage(GL_PIXEL_UNPACK_BUFFER, byteSize, nullptr, flags);
+    m_mapping = static_cast<U8*>(glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, byteSize, flags));
+    StateCache::bindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    if (m_mapping == nullptr) {
+      StateCache::deleteBuffer(m_handle);
+      DG_ENGINE_THROW(std::runtime_error,
+        "Could not persistently map GL pixel upload buffer of {} bytes!", byteSize);
+    }
+
+    m_fences.resize(regionCount, nullptr);
+    m_regionSize = regionSize;
+    m_regionCount = regionCount;
+  }
+
+  PixelUploadBufferImpl::~PixelUploadBufferImpl ()
+  {
+    for (GLsync fence : m_fences) {
+      if (fence != nullptr) { glDeleteSync(fence); }
+    }
+
+    StateCache::bindBuffer(GL_PIXEL_UNPACK_BUFFER, m_handle);
+    glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    StateCache::bindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    StateCache::deleteBuffer(m_handle);
+  }
+
+  void* PixelUploadBufferImpl::acquireRegion ()
+  {
+    if (m_regionAcquired == false) {
+      waitForRegionFence(m_fences.at(m_regionIndex), "pixel upload buffer", m_regionIndex);
+      m_regionAcquired = true;
+    }
+
+    return m_mapping + getRegionOffset();
+  }
+
+  void PixelUploadBufferImpl::releaseRegion ()
+  {
+    if (m_regionAcquired == false) {
+      DG_ENGINE_THROW(std::runtime_error,
+        "Attempt to release unacquired GL pixel upload buffer region {}!", m_regionIndex);
+    }
+
+    m_fences.at(m_regionIndex) = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    m_regionIndex = (m_regionIndex + 1) % m_regionCount;
+    m_regionAcquired = false;
   }
 
 }
@@ -1,6 +1,8 @@
 /** @file DG/OpenGL/GLRenderInterface.cpp */
 
+#include <DG/OpenGL/GLFrameBuffer.hpp>
 #include <DG/OpenGL/GLRenderInterface.hpp>
+#include <DG/OpenGL/GLStateCache.hpp>
 
 namespace dg
 {
@@ -30,11 +32,13 @@ namespace dg::OpenGL
     #if defined(DG_USING_GLFW)
 
     #endif
+
+    StateCache::invalidate();
   }
 
   RenderInterfaceImpl::~RenderInterfaceImpl ()
   {
-
+    FrameBufferImpl::clearAttachmentPool();
   }
 
   void RenderInterfaceImpl::clear ()
@@ -44,20 +48,43 @@ namespace dg::OpenGL
 
   void RenderInterfaceImpl::setClearColor (const Vector4f& color)
   {
-    glClearColor(color.x, color.y, color.z, color.w);
+    StateCache::setClearColor(color);
   }
 
   void RenderInterfaceImpl::setViewport (I32 x, I32 y, I32 width, I32 height)
   {
-    glViewport(x, y, width, height);
+    StateCache::setViewport(x, y, width, height);
   }
 
   void RenderInterfaceImpl::setViewport (I32 width, I32 height)
   {
-    glViewport(0, 0, width, height);
+    StateCache::setViewport(0, 0, width, height);
+  }
+
+  void RenderInterfaceImpl::drawIndexed (const Shared<VertexArray>& vao, Count indexCount,
+    Count baseVertex)
+  {
+    if (vao == nullptr) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to render null GL vertex array object!");
+    }
+    
+    const auto& ibo = vao->getIndexBuffer();
+    if (ibo == nullptr) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to render GL vertex array with no index buffer bound!");
+    }
+
+    if (indexCount == 0 || indexCount > ibo->getIndexCount()) {
+      indexCount = ibo->getIndexCount();
+    }
+
+    vao->bind();
+    glDrawElementsBaseVertex(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, 0, baseVertex);
   }
 
-  void RenderInterfaceImpl::drawIndexed (const Shared<VertexArray>& vao, Count indexCount)
+  void RenderInterfaceImpl::drawIndexedInstanced (const Shared<VertexArray>& vao,
+    Count indexCount, Count instanceCount, Count baseInstance)
   {
     if (vao == nullptr) {
       DG_ENGINE_THROW(std::invalid_argument,
@@ -70,8 +97,51 @@ namespace dg::OpenGL
         "Attempt to render GL vertex array with no index buffer bound!");
     }
 
+    if (indexCount == 0 || indexCount > ibo->getIndexCount()) {
+      indexCount = ibo->getIndexCount();
+    }
+
+    if (instanceCount == 0) { return; }
+
     vao->bind();
-    glDrawElements(GL_TRIANGLES, ibo->getIndexCount(), GL_UNSIGNED_INT, 0);
+    glDrawElementsInstancedBaseInstance(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, 0,
+      instanceCount, baseInstance);
+  }
+
+  void RenderInterfaceImpl::multiDrawIndexedIndirect (const Shared<VertexArray>& vao,
+    const Shared<IndirectBuffer>& commands, Count drawCount, Index firstCommand)
+  {
+    if (vao == nullptr || commands == nullptr) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to multi-draw null GL vertex array object or indirect buffer!");
+    }
+
+    if (vao->getIndexBuffer() == nullptr) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to multi-draw GL vertex array with no index buffer bound!");
+    }
+
+    if (firstCommand + drawCount > commands->getCommandCount()) {
+      DG_ENGINE_THROW(std::out_of_range,
+        "Attempt to multi-draw {} commands from command {} of GL indirect buffer of {} commands!",
+          drawCount, firstCommand, commands->getCommandCount());
+    }
+
+    if (drawCount == 0) { return; }
+
+    // The indirect pointer is read as a byte offset into the bound indirect buffer.
+    vao->bind();
+    commands->bind();
+    glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT,
+      reinterpret_cast<const void*>(firstCommand * sizeof(DrawIndexedIndirectCommand)),
+      drawCount, 0);
+  }
+
+  Count RenderInterfaceImpl::getTextureUnitCount () const
+  {
+    I32 unitCount = 0;
+    glGetIntegerv(GL_MAX_TEXTURE_IMAGE_UNITS, &unitCount);
+    return unitCount;
   }
 
 }
@@ -1,7 +1,17 @@
 /** @file DG/OpenGL/GLShader.cpp */
 
 #include <DG/Core/FileIo.hpp>
+#include <DG/Core/Hash.hpp>
 #include <DG/OpenGL/GLShader.hpp>
+#include <DG/OpenGL/GLStateCache.hpp>
+
+#if !defined(GL_MAX_SHADER_COMPILER_THREADS_KHR)
+  #define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+#endif
+
+#if !defined(GL_COMPLETION_STATUS_KHR)
+  #define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
 
 namespace dg
 {
@@ -16,499 +26,520 @@ namespace dg
     return std::make_shared<OpenGL::ShaderImpl>(vertexCode, fragmentCode);
   }
 
+  Shared<Shader> Shader::makeAsync (const Path& path)
+  {
+    Shared<Shader> shader = std::make_shared<OpenGL::ShaderImpl>(path, ShaderDefines {}, true);
+    if (shader->isReady() == false) { s_pendingShaders.push_back(shader); }
+    return shader;
+  }
+
+  Shared<Shader> Shader::makeAsync (const String& vertexCode, const String& fragmentCode)
+  {
+    Shared<Shader> shader = std::make_shared<OpenGL::ShaderImpl>(vertexCode, fragmentCode, true);
+    if (shader->isReady() == false) { s_pendingShaders.push_back(shader); }
+    return shader;
+  }
+
+  Shared<Shader> Shader::makePermutation (const Path& path, const ShaderDefines& defines,
+    bool async)
+  {
+    Shared<Shader> shader = std::make_shared<OpenGL::ShaderImpl>(path, defines, async);
+    if (shader->isReady() == false) { s_pendingShaders.push_back(shader); }
+    return shader;
+  }
+
 }
 
 namespace dg::OpenGL
 {
 
-  ShaderImpl::ShaderImpl (const Path& path) :
-    Shader {}
-  {
-    String* codePtr = nullptr;
-
-    bool result = FileIo::loadTextFile(
-      path,
-      [&] (StringView line, Index number)
-      {
-        if (line.starts_with("#shader ")){
-          if (line.ends_with("vertex")) { codePtr = &m_vertexCode; }
-          else if (line.ends_with("fragment")) { codePtr = &m_fragmentCode; }
-          else {
-            DG_ENGINE_ERROR("Invalid #shader directive.");
-            return false;
-          }
-        } else {
-          if (codePtr == nullptr) {
-            DG_ENGINE_ERROR("No #shader directive set.");
-            return false;
-          } else {
-            *codePtr += line;
-            *codePtr += "\n";
-          }
+  static bool isParallelCompileSupported ()
+  {
+    // The parallel shader compile extensions are not part of the GL loader, so the one function
+    // they add is loaded here. Letting the driver use as many compiler threads as it likes is what
+    // allows programs to build in the background.
+    static const bool supported = [] {
+      I32 extensionCount = 0;
+      glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount);
+
+      const Char* functionName = nullptr;
+      for (I32 i = 0; i < extensionCount && functionName == nullptr; ++i) {
+        StringView extension { reinterpret_cast<const Char*>(glGetStringi(GL_EXTENSIONS, i)) };
+        if (extension == "GL_KHR_parallel_shader_compile") {
+          functionName = "glMaxShaderCompilerThreadsKHR";
+        } else if (extension == "GL_ARB_parallel_shader_compile") {
+          functionName = "glMaxShaderCompilerThreadsARB";
         }
-
-        return true;
       }
-    );
+
+      if (functionName == nullptr) { return false; }
+
+      #if defined(DG_USING_GLFW)
+        using MaxThreadsFunction = void (*) (GLuint);
+        auto maxShaderCompilerThreads = reinterpret_cast<MaxThreadsFunction>(
+          glfwGetProcAddress(functionName));
+        if (maxShaderCompilerThreads != nullptr) {
+          maxShaderCompilerThreads(0xFFFFFFFF);
+        }
+      #endif
+
+      return true;
+    }();
+
+    return supported;
+  }
+
+  ShaderImpl::ShaderImpl (const Path& path, const ShaderDefines& defines, bool async) :
+    Shader {},
+    m_path { path }
+  {
+    ShaderSource source;
+    bool result = ShaderPreprocessor::load(path, defines, source);
+    m_vertexCode = std::move(source.vertexCode);
+    m_fragmentCode = std::move(source.fragmentCode);
+    m_sourceFiles = std::move(source.sourceFiles);
 
     if (result == false) {
       DG_ENGINE_ERROR("Could not parse GLSL shader file '{}'.", path);
+      m_ready = true;
       return;
     }
 
-    m_valid = build();
-    if (m_valid == false) {
-      DG_ENGINE_ERROR("Could not build GLSL shader from file '{}'.", path);
-    }
+    startBuild(async);
   }
 
-  ShaderImpl::ShaderImpl (const String& vertexCode, const String& fragmentCode) :
+  ShaderImpl::ShaderImpl (const String& vertexCode, const String& fragmentCode, bool async) :
     Shader {},
     m_vertexCode { vertexCode },
     m_fragmentCode { fragmentCode }
   {
-    m_valid = build();
-    if (m_valid == false) {
-      DG_ENGINE_ERROR("Could not build GLSL shader from source code.");
-    }
+    startBuild(async);
   }
 
   ShaderImpl::~ShaderImpl ()
   {
+    glDeleteProgram(m_pendingProgram);
+    glDeleteShader(m_vertexShader);
+    glDeleteShader(m_fragmentShader);
     glDeleteProgram(m_handle);
   }
 
+  bool ShaderImpl::poll ()
+  {
+    if (m_ready == true) { return true; }
+
+    // Without parallel compilation, there is no way to ask whether the build is done without
+    // waiting for it, so it is finished on the first poll.
+    if (isParallelCompileSupported() == true) {
+      I32 complete = GL_FALSE;
+      glGetProgramiv(m_pendingProgram, GL_COMPLETION_STATUS_KHR, &complete);
+      if (complete == GL_FALSE) { return false; }
+    }
+
+    wait();
+    return true;
+  }
+
+  void ShaderImpl::wait ()
+  {
+    if (m_ready == true) { return; }
+
+    m_valid = (m_pendingProgram == 0) ? (m_handle != 0) : finishBuild();
+    m_ready = true;
+    if (m_valid == false) {
+      if (m_path.empty() == true) {
+        DG_ENGINE_ERROR("Could not build GLSL shader from source code.");
+      } else {
+        DG_ENGINE_ERROR("Could not build GLSL shader from file '{}'.", m_path);
+      }
+    }
+  }
+
   void ShaderImpl::bind () const
   {
-    glUseProgram(m_handle);
+    StateCache::useProgram(m_handle);
   }
 
   void ShaderImpl::unbind () const
   {
-    glUseProgram(0);
+    StateCache::useProgram(0);
   }
 
-  bool ShaderImpl::setInteger (const String& key, I32 value)
+  void ShaderImpl::startBuild (bool async)
   {
-    if (m_valid == false || m_handle == 0) {
-      DG_ENGINE_THROW(std::runtime_error,
-        "Attempt to set uniform on an invalid shader!");
+    // A program loaded from the program cache is already built, so only a program which is still
+    // compiling is left pending.
+    if (beginBuild() == false) {
+      m_ready = true;
+      if (m_path.empty() == true) {
+        DG_ENGINE_ERROR("Could not build GLSL shader from source code.");
+      } else {
+        DG_ENGINE_ERROR("Could not build GLSL shader from file '{}'.", m_path);
+      }
+
+      return;
     }
 
-    I32 uniform = findUniform(key);
-    if (uniform == -1) { return false; }
+    if (async == false || m_pendingProgram == 0) {
+      wait();
+    }
+  }
 
-    glUseProgram(m_handle);
+  UniformHandle ShaderImpl::findUniform (const String& name) const
+  {
+    auto iter = m_uniforms.find(name);
+    return (iter != m_uniforms.end()) ? UniformHandle { iter->second, m_handle } :
+      UniformHandle {};
+  }
 
-    glUniform1i(uniform, value);
-    return true;
+  bool ShaderImpl::setInteger (const String& key, I32 value)
+  {
+    return setInteger(findUniform(key), value);
   }
 
   bool ShaderImpl::setUnsignedInteger (const String& key, U32 value)
   {
-    if (m_valid == false || m_handle == 0) {
-      DG_ENGINE_THROW(std::runtime_error,
-        "Attempt to set uniform on an invalid shader!");
-    }
-
-    I32 uniform = findUniform(key);
-    if (uniform == -1) { return false; }
-
-    glUseProgram(m_handle);
-
-    glUniform1ui(uniform, value);
-    return true;
+    return setUnsignedInteger(findUniform(key), value);
   }
 
   bool ShaderImpl::setFloat (const String& key, F32 value)
   {
-    if (m_valid == false || m_handle == 0) {
-      DG_ENGINE_THROW(std::runtime_error,
-        "Attempt to set uniform on an invalid shader!");
-    }
-
-    I32 uniform = findUniform(key);
-    if (uniform == -1) { return false; }
-
-    glUseProgram(m_handle);
-
-    glUniform1f(uniform, value);
-    return true;
+    return setFloat(findUniform(key), value);
   }
 
   bool ShaderImpl::setDouble (const String& key, F64 value)
   {
-    if (m_valid == false || m_handle == 0) {
-      DG_ENGINE_THROW(std::runtime_error,
-        "Attempt to set uniform on an invalid shader!");
-    }
-
-    I32 uniform = findUniform(key);
-    if (uniform == -1) { return false; }
-
-    glUseProgram(m_handle);
-
-    glUniform1d(uniform, value);
-    return true;
+    return setDouble(findUniform(key), value);
   }
 
   bool ShaderImpl::setBoolean (const String& key, bool value)
   {
-    if (m_valid == false || m_handle == 0) {
-      DG_ENGINE_THROW(std::runtime_error,
-        "Attempt to set uniform on an invalid shader!");
-    }
-
-    I32 uniform = findUniform(key);
-    if (uniform == -1) { return false; }
-
-    glUseProgram(m_handle);
-
-    glUniform1i(uniform, value);
-    return true;
+    return setBoolean(findUniform(key), value);
   }
 
   bool ShaderImpl::setVector2i (const String& key, const Vector2i& value)
   {
-    if (m_valid == false || m_handle == 0) {
-      DG_ENGINE_THROW(std::runtime_error,
-        "Attempt to set uniform on an invalid shader!");
-    }
-
-    I32 uniform = findUniform(key);
-    if (uniform == -1) { return false; }
-
-    glUseProgram(m_handle);
-    
-    glUniform2i(uniform, value.x, value.y);
-    return true;    
+    return setVector2i(findUniform(key), value);
   }
 
   bool ShaderImpl::setVector2u (const String& key, const Vector2u& value)
   {
-    if (m_valid == false || m_handle == 0) {
-      DG_ENGINE_THROW(std::runtime_error,
-        "Attempt to set uniform on an invalid shader!");
-    }
-
-    I32 uniform = findUniform(key);
-    if (uniform == -1) { return false; }
-
-    glUseProgram(m_handle);
-    
-    glUniform2ui(uniform, value.x, value.y);
-    return true;    
+    return setVector2u(findUniform(key), value);
   }
 
   bool ShaderImpl::setVector2f (const String& key, const Vector2f& value)
   {
-    if (m_valid == false || m_handle == 0) {
-      DG_ENGINE_THROW(std::runtime_error,
-        "Attempt to set uniform on an invalid shader!");
-    }
+    return setVector2f(findUniform(key), value);
+  }
 
-    I32 uniform = findUniform(key);
-    if (uniform == -1) { return false; }
+  bool ShaderImpl::setVector2d (const String& key, const Vector2d& value)
+  {
+    return setVector2d(findUniform(key), value);
+  }
 
-    glUseProgram(m_handle);
-    
-    glUniform2f(uniform, value.x, value.y);
-    return true;    
+  bool ShaderImpl::setVector2b (const String& key, const Vector2b& value)
+  {
+    return setVector2b(findUniform(key), value);
   }
 
-  bool ShaderImpl::setVector2d (const String& key, const Vector2d& value)
+  bool ShaderImpl::setVector3i (const String& key, const Vector3i& value)
   {
-    if (m_valid == false || m_handle == 0) {
-      DG_ENGINE_THROW(std::runtime_error,
-        "Attempt to set uniform on an invalid shader!");
-    }
+    return setVector3i(findUniform(key), value);
+  }
 
-    I32 uniform = findUniform(key);
-    if (uniform == -1) { return false; }
+  bool ShaderImpl::setVector3u (const String& key, const Vector3u& value)
+  {
+    return setVector3u(findUniform(key), value);
+  }
 
-    glUseProgram(m_handle);
-    
-    glUniform2d(uniform, value.x, value.y);
-    return true;    
+  bool ShaderImpl::setVector3f (const String& key, const Vector3f& value)
+  {
+    return setVector3f(findUniform(key), value);
   }
 
-  bool ShaderImpl::setVector2b (const String& key, const Vector2b& value)
+  bool ShaderImpl::setVector3d (const String& key, const Vector3d& value)
   {
-    if (m_valid == false || m_handle == 0) {
-      DG_ENGINE_THROW(std::runtime_error,
-        "Attempt to set uniform on an invalid shader!");
-    }
+    return setVector3d(findUniform(key), value);
+  }
 
-    I32 uniform = findUniform(key);
-    if (uniform == -1) { return false; }
+  bool ShaderImpl::setVector3b (const String& key, const Vector3b& value)
+  {
+    return setVector3b(findUniform(key), value);
+  }
 
-    glUseProgram(m_handle);
-    
-    glUniform2i(uniform, value.x, value.y);
-    return true;    
+  bool ShaderImpl::setVector4i (const String& key, const Vector4i& value)
+  {
+    return setVector4i(findUniform(key), value);
   }
 
-  bool ShaderImpl::setVector3i (const String& key, const Vector3i& value)
+  bool ShaderImpl::setVector4u (const String& key, const Vector4u& value)
   {
-    if (m_valid == false || m_handle == 0) {
-      DG_ENGINE_THROW(std::runtime_error,
-        "Attempt to set uniform on an invalid shader!");
-    }
+    return setVector4u(findUniform(key), value);
+  }
 
-    I32 uniform = findUniform(key);
-    if (uniform == -1) { return false; }
+  bool ShaderImpl::setVector4f (const String& key, const Vector4f& value)
+  {
+    return setVector4f(findUniform(key), value);
+  }
 
-    glUseProgram(m_handle);
-    
-    glUniform3i(uniform, value.x, value.y, value.z);
-    return true;    
+  bool ShaderImpl::setVector4d (const String& key, const Vector4d& value)
+  {
+    return setVector4d(findUniform(key), value);
   }
 
-  bool ShaderImpl::setVector3u (const String& key, const Vector3u& value)
+  bool ShaderImpl::setVector4b (const String& key, const Vector4b& value)
   {
-    if (m_valid == false || m_handle == 0) {
-      DG_ENGINE_THROW(std::runtime_error,
-        "Attempt to set uniform on an invalid shader!");
-    }
+    return setVector4b(findUniform(key), value);
+  }
 
-    I32 uniform = findUniform(key);
-    if (uniform == -1) { return false; }
+  bool ShaderImpl::setMatrix2f (const String& key, const Matrix2f& value)
+  {
+    return setMatrix2f(findUniform(key), value);
+  }
 
-    glUseProgram(m_handle);
-    
-    glUniform3ui(uniform, value.x, value.y, value.z);
-    return true;    
+  bool ShaderImpl::setMatrix3f (const String& key, const Matrix3f& value)
+  {
+    return setMatrix3f(findUniform(key), value);
   }
 
-  bool ShaderImpl::setVector3f (const String& key, const Vector3f& value)
+  bool ShaderImpl::setMatrix4f (const String& key, const Matrix4f& value)
   {
-    if (m_valid == false || m_handle == 0) {
-      DG_ENGINE_THROW(std::runtime_error,
-        "Attempt to set uniform on an invalid shader!");
-    }
+    return setMatrix4f(findUniform(key), value);
+  }
 
-    I32 uniform = findUniform(key);
-    if (uniform == -1) { return false; }
+  bool ShaderImpl::setMatrix2d (const String& key, const Matrix2d& value)
+  {
+    return setMatrix2d(findUniform(key), value);
+  }
 
-    glUseProgram(m_handle);
-    
-    glUniform3f(uniform, value.x, value.y, value.z);
-    return true;    
+  bool ShaderImpl::setMatrix3d (const String& key, const Matrix3d& value)
+  {
+    return setMatrix3d(findUniform(key), value);
   }
 
-  bool ShaderImpl::setVector3d (const String& key, const Vector3d& value)
+  bool ShaderImpl::setMatrix4d (const String& key, const Matrix4d& value)
   {
-    if (m_valid == false || m_handle == 0) {
-      DG_ENGINE_THROW(std::runtime_error,
-        "Attempt to set uniform on an invalid shader!");
-    }
+    return setMatrix4d(findUniform(key), value);
+  }
 
-    I32 uniform = findUniform(key);
-    if (uniform == -1) { return false; }
+  bool ShaderImpl::setInteger (UniformHandle uniform, I32 value)
+  {
+    if (checkUniform(uniform) == false) { return false; }
 
-    glUseProgram(m_handle);
-    
-    glUniform3d(uniform, value.x, value.y, value.z);
-    return true;    
+    glProgramUniform1i(m_handle, uniform.location, value);
+    return true;
   }
 
-  bool ShaderImpl::setVector3b (const String& key, const Vector3b& value)
+  bool ShaderImpl::setUnsignedInteger (UniformHandle uniform, U32 value)
   {
-    if (m_valid == false || m_handle == 0) {
-      DG_ENGINE_THROW(std::runtime_error,
-        "Attempt to set uniform on an invalid shader!");
-    }
+    if (checkUniform(uniform) == false) { return false; }
 
-    I32 uniform = findUniform(key);
-    if (uniform == -1) { return false; }
+    glProgramUniform1ui(m_handle, uniform.location, value);
+    return true;
+  }
+
+  bool ShaderImpl::setFloat (UniformHandle uniform, F32 value)
+  {
+    if (checkUniform(uniform) == false) { return false; }
 
-    glUseProgram(m_handle);
-    
-    glUniform3i(uniform, value.x, value.y, value.z);
-    return true;    
+    glProgramUniform1f(m_handle, uniform.location, value);
+    return true;
   }
 
-  bool ShaderImpl::setVector4i (const String& key, const Vector4i& value)
+  bool ShaderImpl::setDouble (UniformHandle uniform, F64 value)
   {
-    if (m_valid == false || m_handle == 0) {
-      DG_ENGINE_THROW(std::runtime_error,
-        "Attempt to set uniform on an invalid shader!");
-    }
+    if (checkUniform(uniform) == false) { return false; }
+
+    glProgramUniform1d(m_handle, uniform.location, value);
+    return true;
+  }
 
-    I32 uniform = findUniform(key);
-    if (uniform == -1) { return false; }
+  bool ShaderImpl::setBoolean (UniformHandle uniform, bool value)
+  {
+    if (checkUniform(uniform) == false) { return false; }
 
-    glUseProgram(m_handle);
-    
-    glUniform4i(uniform, value.x, value.y, value.z, value.w);
-    return true;    
+    glProgramUniform1i(m_handle, uniform.location, value);
+    return true;
   }
 
-  bool ShaderImpl::setVector4u (const String& key, const Vector4u& value)
+  bool ShaderImpl::setVector2i (UniformHandle uniform, const Vector2i& value)
   {
-    if (m_valid == false || m_handle == 0) {
-      DG_ENGINE_THROW(std::runtime_error,
-        "Attempt to set uniform on an invalid shader!");
-    }
+    if (checkUniform(uniform) == false) { return false; }
 
-    I32 uniform = findUniform(key);
-    if (uniform == -1) { return false; }
+    glProgramUniform2i(m_handle, uniform.location, value.x, value.y);
+    return true;
+  }
 
-    glUseProgram(m_handle);
-    
-    glUniform4ui(uniform, value.x, value.y, value.z, value.w);
-    return true;    
+  bool ShaderImpl::setVector2u (UniformHandle uniform, const Vector2u& value)
+  {
+    if (checkUniform(uniform) == false) { return false; }
+
+    glProgramUniform2ui(m_handle, uniform.location, value.x, value.y);
+    return true;
   }
 
-  bool ShaderImpl::setVector4f (const String& key, const Vector4f& value)
+  bool ShaderImpl::setVector2f (UniformHandle uniform, const Vector2f& value)
   {
-    if (m_valid == false || m_handle == 0) {
-      DG_ENGINE_THROW(std::runtime_error,
-        "Attempt to set uniform on an invalid shader!");
-    }
+    if (checkUniform(uniform) == false) { return false; }
 
-    I32 uniform = findUniform(key);
-    if (uniform == -1) { return false; }
+    glProgramUniform2f(m_handle, uniform.location, value.x, value.y);
+    return true;
+  }
 
-    glUseProgram(m_handle);
-    
-    glUniform4f(uniform, value.x, value.y, value.z, value.w);
-    return true;    
+  bool ShaderImpl::setVector2d (UniformHandle uniform, const Vector2d& value)
+  {
+    if (checkUniform(uniform) == false) { return false; }
+
+    glProgramUniform2d(m_handle, uniform.location, value.x, value.y);
+    return true;
   }
 
-  bool ShaderImpl::setVector4d (const String& key, const Vector4d& value)
+  bool ShaderImpl::setVector2b (UniformHandle uniform, const Vector2b& value)
   {
-    if (m_valid == false || m_handle == 0) {
-      DG_ENGINE_THROW(std::runtime_error,
-        "Attempt to set uniform on an invalid shader!");
-    }
+    if (checkUniform(uniform) == false) { return false; }
+
+    glProgramUniform2i(m_handle, uniform.location, value.x, value.y);
+    return true;
+  }
 
-    I32 uniform = findUniform(key);
-    if (uniform == -1) { return false; }
+  bool ShaderImpl::setVector3i (UniformHandle uniform, const Vector3i& value)
+  {
+    if (checkUniform(uniform) == false) { return false; }
 
-    glUseProgram(m_handle);
-    
-    glUniform4d(uniform, value.x, value.y, value.z, value.w);
-    return true;    
+    glProgramUniform3i(m_handle, uniform.location, value.x, value.y, value.z);
+    return true;
   }
 
-  bool ShaderImpl::setVector4b (const String& key, const Vector4b& value)
+  bool ShaderImpl::setVector3u (UniformHandle uniform, const Vector3u& value)
   {
-    if (m_valid == false || m_handle == 0) {
-      DG_ENGINE_THROW(std::runtime_error,
-        "Attempt to set uniform on an invalid shader!");
-    }
+    if (checkUniform(uniform) == false) { return false; }
 
-    I32 uniform = findUniform(key);
-    if (uniform == -1) { return false; }
+    glProgramUniform3ui(m_handle, uniform.location, value.x, value.y, value.z);
+    return true;
+  }
+
+  bool ShaderImpl::setVector3f (UniformHandle uniform, const Vector3f& value)
+  {
+    if (checkUniform(uniform) == false) { return false; }
 
-    glUseProgram(m_handle);
-    
-    glUniform4i(uniform, value.x, value.y, value.z, value.w);
-    return true;    
+    glProgramUniform3f(m_handle, uniform.location, value.x, value.y, value.z);
+    return true;
   }
 
-  bool ShaderImpl::setMatrix2f (const String& key, const Matrix2f& value)
+  bool ShaderImpl::setVector3d (UniformHandle uniform, const Vector3d& value)
   {
-    if (m_valid == false || m_handle == 0) {
-      DG_ENGINE_THROW(std::runtime_error,
-        "Attempt to set uniform on an invalid shader!");
-    }
+    if (checkUniform(uniform) == false) { return false; }
+
+    glProgramUniform3d(m_handle, uniform.location, value.x, value.y, value.z);
+    return true;
+  }
 
-    I32 uniform = findUniform(key);
-    if (uniform == -1) { return false; }
+  bool ShaderImpl::setVector3b (UniformHandle uniform, const Vector3b& value)
+  {
+    if (checkUniform(uniform) == false) { return false; }
 
-    glUseProgram(m_handle);
-    
-    glUniformMatrix2fv(uniform, 1, GL_TRUE, value.getPointer());
-    return true;   
+    glProgramUniform3i(m_handle, uniform.location, value.x, value.y, value.z);
+    return true;
   }
 
-  bool ShaderImpl::setMatrix3f (const String& key, const Matrix3f& value)
+  bool ShaderImpl::setVector4i (UniformHandle uniform, const Vector4i& value)
   {
-    if (m_valid == false || m_handle == 0) {
-      DG_ENGINE_THROW(std::runtime_error,
-        "Attempt to set uniform on an invalid shader!");
-    }
+    if (checkUniform(uniform) == false) { return false; }
 
-    I32 uniform = findUniform(key);
-    if (uniform == -1) { return false; }
+    glProgramUniform4i(m_handle, uniform.location, value.x, value.y, value.z, value.w);
+    return true;
+  }
 
-    glUseProgram(m_handle);
-    
-    glUniformMatrix3fv(uniform, 1, GL_TRUE, value.getPointer());
-    return true;  
+  bool ShaderImpl::setVector4u (UniformHandle uniform, const Vector4u& value)
+  {
+    if (checkUniform(uniform) == false) { return false; }
+
+    glProgramUniform4ui(m_handle, uniform.location, value.x, value.y, value.z, value.w);
+    return true;
   }
 
-  bool ShaderImpl::setMatrix4f (const String& key, const Matrix4f& value)
+  bool ShaderImpl::setVector4f (UniformHandle uniform, const Vector4f& value)
   {
-    if (m_valid == false || m_handle == 0) {
-      DG_ENGINE_THROW(std::runtime_error,
-        "Attempt to set uniform on an invalid shader!");
-    }
+    if (checkUniform(uniform) == false) { return false; }
 
-    I32 uniform = findUniform(key);
-    if (uniform == -1) { return false; }
+    glProgramUniform4f(m_handle, uniform.location, value.x, value.y, value.z, value.w);
+    return true;
+  }
 
-    glUseProgram(m_handle);
-    
-    glUniformMatrix4fv(uniform, 1, GL_TRUE, value.getPointer());
-    return true;  
+  bool ShaderImpl::setVector4d (UniformHandle uniform, const Vector4d& value)
+  {
+    if (checkUniform(uniform) == false) { return false; }
+
+    glProgramUniform4d(m_handle, uniform.location, value.x, value.y, value.z, value.w);
+    return true;
   }
 
-  bool ShaderImpl::setMatrix2d (const String& key, const Matrix2d& value)
+  bool ShaderImpl::setVector4b (UniformHandle uniform, const Vector4b& value)
   {
-    if (m_valid == false || m_handle == 0) {
-      DG_ENGINE_THROW(std::runtime_error,
-        "Attempt to set uniform on an invalid shader!");
-    }
+    if (checkUniform(uniform) == false) { return false; }
+
+    glProgramUniform4i(m_handle, uniform.location, value.x, value.y, value.z, value.w);
+    return true;
+  }
 
-    I32 uniform = findUniform(key);
-    if (uniform == -1) { return false; }
+  bool ShaderImpl::setMatrix2f (UniformHandle uniform, const Matrix2f& value)
+  {
+    if (checkUniform(uniform) == false) { return false; }
 
-    glUseProgram(m_handle);
-    
-    glUniformMatrix2dv(uniform, 1, GL_TRUE, value.getPointer());
-    return true;  
+    glProgramUniformMatrix2fv(m_handle, uniform.location, 1, GL_TRUE, value.getPointer());
+    return true;
   }
 
-  bool ShaderImpl::setMatrix3d (const String& key, const Matrix3d& value)
+  bool ShaderImpl::setMatrix3f (UniformHandle uniform, const Matrix3f& value)
   {
-    if (m_valid == false || m_handle == 0) {
-      DG_ENGINE_THROW(std::runtime_error,
-        "Attempt to set uniform on an invalid shader!");
-    }
+    if (checkUniform(uniform) == false) { return false; }
 
-    I32 uniform = findUniform(key);
-    if (uniform == -1) { return false; }
+    glProgramUniformMatrix3fv(m_handle, uniform.location, 1, GL_TRUE, value.getPointer());
+    return true;
+  }
+
+  bool ShaderImpl::setMatrix4f (UniformHandle uniform, const Matrix4f& value)
+  {
+    if (checkUniform(uniform) == false) { return false; }
 
-    glUseProgram(m_handle);
-    
-    glUniformMatrix2dv(uniform, 1, GL_TRUE, value.getPointer());
-    return true;  
+    glProgramUniformMatrix4fv(m_handle, uniform.location, 1, GL_TRUE, value.getPointer());
+    return true;
   }
 
-  bool ShaderImpl::setMatrix4d (const String& key, const Matrix4d& value)
+  bool ShaderImpl::setMatrix2d (UniformHandle uniform, const Matrix2d& value)
   {
-    if (m_valid == false || m_handle == 0) {
-      DG_ENGINE_THROW(std::runtime_error,
-        "Attempt to set uniform on an invalid shader!");
-    }
+    if (checkUniform(uniform) == false) { return false; }
+
+    glProgramUniformMatrix2dv(m_handle, uniform.location, 1, GL_TRUE, value.getPointer());
+    return true;
+  }
 
-    I32 uniform = findUniform(key);
-    if (uniform == -1) { return false; }
+  bool ShaderImpl::setMatrix3d (UniformHandle uniform, const Matrix3d& value)
+  {
+    if (checkUniform(uniform) == false) { return false; }
 
-    glUseProgram(m_handle);
-    
-    glUniformMatrix2dv(uniform, 1, GL_TRUE, value.getPointer());
-    return true;  
+    glProgramUniformMatrix3dv(m_handle, uniform.location, 1, GL_TRUE, value.getPointer());
+    return true;
   }
 
-  bool ShaderImpl::build ()
+  bool ShaderImpl::setMatrix4d (UniformHandle uniform, const Matrix4d& value)
   {
-    // The length of the status info log string.
-    static constexpr I32 INFO_LOG_LENGTH = 512;
+    if (checkUniform(uniform) == false) { return false; }
+
+    glProgramUniformMatrix4dv(m_handle, uniform.location, 1, GL_TRUE, value.getPointer());
+    return true;
+  }
+
+  bool ShaderImpl::setIntegerArray (UniformHandle uniform, const I32* values, const Count count)
+  {
+    if (checkUniform(uniform) == false || values == nullptr || count == 0) { return false; }
 
+    glProgramUniform1iv(m_handle, uniform.location, count, values);
+    return true;
+  }
+
+  bool ShaderImpl::beginBuild ()
+  {
     // Ensure that both vertex and fragment shader code was provided.
     if (m_vertexCode.empty()) {
       DG_ENGINE_ERROR("No vertex shader code provided.");
@@ -518,37 +549,77 @@ namespace dg::OpenGL
       return false;
     }
 
-    // Keep track of a status code and an info log.
-    I32 status = 0;
-    Char infoLog[INFO_LOG_LENGTH];
+    // If a program built from the same source code by the same driver was cached, load that
+    // instead of compiling the source code again.
+    m_cachePath = getProgramCachePath();
+    if (m_cachePath.empty() == false && loadProgramBinary(m_cachePath) == true) {
+      return true;
+    }
 
     // We will need the C-string forms of the shader's source code strings.
     const Char* vertexCode = m_vertexCode.c_str();
     const Char* fragmentCode = m_fragmentCode.c_str();
 
-    // Begin by compiling the vertex shader code, then check the compilation
-    // status.
-    U32 vertexShader = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vertexShader, 1, &vertexCode, nullptr);
-    glCompileShader(vertexShader);
+    // Compile both shaders and link the program without querying any of their statuses, since
+    // that would wait for the driver to finish. With parallel compilation, the driver can then
+    // build the program in the background until it is polled.
+    isParallelCompileSupported();
+
+    m_vertexShader = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(m_vertexShader, 1, &vertexCode, nullptr);
+    glCompileShader(m_vertexShader);
+
+    m_fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(m_fragmentShader, 1, &fragmentCode, nullptr);
+    glCompileShader(m_fragmentShader);
+
+    m_pendingProgram = glCreateProgram();
+    glAttachShader(m_pendingProgram, m_vertexShader);
+    glAttachShader(m_pendingProgram, m_fragmentShader);
+    if (m_cachePath.empty() == false) {
+      glProgramParameteri(m_pendingProgram, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+
+    glLinkProgram(m_pendingProgram);
+    return true;
+  }
+
+  bool ShaderImpl::finishBuild ()
+  {
+    // The length of the status info log string.
+    static constexpr I32 INFO_LOG_LENGTH = 512;
+
+    // Keep track of a status code and an info log.
+    I32 status = 0;
+    Char infoLog[INFO_LOG_LENGTH];
+
+    // Take ownership of the objects built by `beginBuild`, so that they are deleted on every path
+    // out of this method.
+    U32 vertexShader = std::exchange(m_vertexShader, 0);
+    U32 fragmentShader = std::exchange(m_fragmentShader, 0);
+    U32 shaderProgram = std::exchange(m_pendingProgram, 0);
+
+    // Check the vertex shader's compilation status.
     glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &status);
     glGetShaderInfoLog(vertexShader, INFO_LOG_LENGTH, nullptr, infoLog);
     if (status != GL_TRUE) {
       DG_ENGINE_ERROR("Error compiling GLSL vertex shader: {}", infoLog);
+      logSourceFiles();
+      glDeleteProgram(shaderProgram);
       glDeleteShader(vertexShader);
+      glDeleteShader(fragmentShader);
       return false;
     } else if (infoLog[0] != '\0') {
       DG_ENGINE_WARN("GLSL vertex shader compiled with warning: {}", infoLog);
     }
 
     // Repeat this now for the fragment shader.
-    U32 fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(fragmentShader, 1, &fragmentCode, nullptr);
-    glCompileShader(fragmentShader);
     glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &status);
     glGetShaderInfoLog(fragmentShader, INFO_LOG_LENGTH, nullptr, infoLog);
     if (status != GL_TRUE) {
       DG_ENGINE_ERROR("Error compiling GLSL fragment shader: {}", infoLog);
+      logSourceFiles();
+      glDeleteProgram(shaderProgram);
       glDeleteShader(vertexShader);
       glDeleteShader(fragmentShader);
       return false;
@@ -556,14 +627,7 @@ namespace dg::OpenGL
       DG_ENGINE_WARN("GLSL fragment shader compiled with warning: {}", infoLog);
     }
 
-    // Next, create the shader program and attach the above-compiled shaders
-    // to it.
-    U32 shaderProgram = glCreateProgram();
-    glAttachShader(shaderProgram, vertexShader);
-    glAttachShader(shaderProgram, fragmentShader);
-
-    // Link the program, then check status.
-    glLinkProgram(shaderProgram);
+    // Then check the program's link status.
     glGetProgramiv(shaderProgram, GL_LINK_STATUS, &status);
     glGetProgramInfoLog(shaderProgram, INFO_LOG_LENGTH, nullptr, infoLog);
     if (status != GL_TRUE) {
@@ -587,13 +651,168 @@ namespace dg::OpenGL
     }
 
     m_handle = shaderProgram;
-    return true;     
+    reflectUniforms();
+    if (m_cachePath.empty() == false) {
+      saveProgramBinary(m_cachePath);
+    }
+
+    return true;
+  }
+
+  Path ShaderImpl::getProgramCachePath () const
+  {
+    // Program binaries are only usable by the driver which produced them, so the driver's strings
+    // are hashed along with the source code. A separator byte is hashed between each input, so
+    // that moving text from one input to the next changes the hash.
+    const Path& directory = getProgramCacheDirectory();
+    if (directory.empty() == true) { return {}; }
+
+    I32 formatCount = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+    if (formatCount == 0) { return {}; }
+
+    U64 key = FNV1A_OFFSET_BASIS;
+    for (StringView input : {
+      StringView { m_vertexCode },
+      StringView { m_fragmentCode },
+      StringView { reinterpret_cast<const Char*>(glGetString(GL_VENDOR)) },
+      StringView { reinterpret_cast<const Char*>(glGetString(GL_RENDERER)) },
+      StringView { reinterpret_cast<const Char*>(glGetString(GL_VERSION)) }
+    }) {
+      key = fnv1a(input, key);
+      key = fnv1a("\0", 1, key);
+    }
+
+    Char fileName[24];
+    std::snprintf(fileName, sizeof(fileName), "%016llx.bin", static_cast<unsigned long long>(key));
+    return directory / fileName;
+  }
+
+  bool ShaderImpl::loadProgramBinary (const Path& path)
+  {
+    if (fs::exists(path) == false) { return false; }
+
+    Collection<U8> contents;
+    ProgramBinaryHeader header;
+    if (
+      FileIo::loadBinaryFile(path, contents) == false ||
+      contents.size() <= sizeof(ProgramBinaryHeader)
+    ) {
+      DG_ENGINE_WARN("Could not read cached GLSL shader program '{}'.", path);
+      return false;
+    }
+
+    std::memcpy(&header, contents.data(), sizeof(ProgramBinaryHeader));
+    if (header.magic != ProgramBinaryHeader::MAGIC) {
+      DG_ENGINE_WARN("Cached GLSL shader program '{}' is not a program binary.", path);
+      return false;
+    }
+
+    // A driver update may leave the driver's strings unchanged, yet reject binaries made by the
+    // old driver, in which case the program is built from source and cached again.
+    I32 status = 0;
+    U32 shaderProgram = glCreateProgram();
+    glProgramParameteri(shaderProgram, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    glProgramBinary(shaderProgram, header.format, contents.data() + sizeof(ProgramBinaryHeader),
+      contents.size() - sizeof(ProgramBinaryHeader));
+    glGetProgramiv(shaderProgram, GL_LINK_STATUS, &status);
+    if (status != GL_TRUE) {
+      DG_ENGINE_WARN("Cached GLSL shader program '{}' was rejected by the driver.", path);
+      glDeleteProgram(shaderProgram);
+      return false;
+    }
+
+    if (m_handle != 0) {
+      glDeleteProgram(m_handle);
+    }
+
+    m_handle = shaderProgram;
+    reflectUniforms();
+    return true;
+  }
+
+  void ShaderImpl::saveProgramBinary (const Path& path) const
+  {
+    I32 binaryLength = 0;
+    glGetProgramiv(m_handle, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+    if (binaryLength <= 0) { return; }
+
+    ProgramBinaryHeader header;
+    Collection<U8> contents(sizeof(ProgramBinaryHeader) + binaryLength);
+    glGetProgramBinary(m_handle, binaryLength, nullptr, &header.format,
+      contents.data() + sizeof(ProgramBinaryHeader));
+    std::memcpy(contents.data(), &header, sizeof(ProgramBinaryHeader));
+
+    if (FileIo::saveBinaryFile(path, contents.data(), contents.size()) == false) {
+      DG_ENGINE_WARN("Could not cache GLSL shader program to '{}'.", path);
+    }
+  }
+
+  void ShaderImpl::reflectUniforms ()
+  {
+    // Every active uniform's location is looked up once, after the program is linked. An array is
+    // also entered under its bare name and under each of its elements' names, since the locations
+    // of its elements need not be consecutive.
+    static constexpr GLenum PROPERTIES[] = { GL_LOCATION, GL_ARRAY_SIZE };
+
+    m_uniforms.clear();
+
+    I32 uniformCount = 0, maxNameLength = 0;
+    glGetProgramInterfaceiv(m_handle, GL_UNIFORM, GL_ACTIVE_RESOURCES, &uniformCount);
+    glGetProgramInterfaceiv(m_handle, GL_UNIFORM, GL_MAX_NAME_LENGTH, &maxNameLength);
+
+    String name(maxNameLength, '\0');
+    for (I32 i = 0; i < uniformCount; ++i) {
+      I32 properties[2] = { -1, 0 };
+      glGetProgramResourceiv(m_handle, GL_UNIFORM, i, 2, PROPERTIES, 2, nullptr, properties);
+      if (properties[0] == -1) { continue; }
+
+      I32 nameLength = 0;
+      glGetProgramResourceName(m_handle, GL_UNIFORM, i, maxNameLength, &nameLength, name.data());
+
+      StringView uniformName { name.data(), static_cast<Size>(nameLength) };
+      m_uniforms.emplace(uniformName, properties[0]);
+      if (uniformName.ends_with("[0]") == true) {
+        String baseName { uniformName.substr(0, uniformName.size() - 3) };
+        m_uniforms.emplace(baseName, properties[0]);
+
+        for (I32 j = 1; j < properties[1]; ++j) {
+          String elementName = baseName + "[" + std::to_string(j) + "]";
+          m_uniforms.emplace(elementName,
+            glGetProgramResourceLocation(m_handle, GL_UNIFORM, elementName.c_str()));
+        }
+      }
+    }
   }
 
-  I32 ShaderImpl::findUniform (StringView key)
+  bool ShaderImpl::checkUniform (UniformHandle uniform) const
   {
-    if (isValid() == false || key.empty()) { return -1; }
-    return glGetUniformLocation(m_handle, key.data());    
+    if (m_valid == false || m_handle == 0) {
+      DG_ENGINE_THROW(std::runtime_error,
+        "Attempt to set uniform on an invalid shader!");
+    }
+
+    if (uniform.isValid() == false) { return false; }
+
+    if (uniform.program != m_handle) {
+      #if defined(DG_DEBUG)
+        DG_ENGINE_THROW(std::invalid_argument,
+          "Attempt to set uniform through a handle found in another GL program!");
+      #endif
+
+      return false;
+    }
+
+    return true;
+  }
+
+  void ShaderImpl::logSourceFiles () const
+  {
+    // The compiler reports each error against a source string number, set by the preprocessor's
+    // #line directives, followed by the line number within that file.
+    for (Index i = 0; i < m_sourceFiles.size(); ++i) {
+      DG_ENGINE_ERROR("  Source string {} is '{}'.", i, m_sourceFiles[i]);
+    }
   }
 
 }
@@ -0,0 +1,333 @@
+/** @file DG/OpenGL/GLStateCache.cpp */
+
+#include <DG/OpenGL/GLStateCache.hpp>
+
+namespace dg::OpenGL
+{
+
+  struct TargetQuery
+  {
+    GLenum target;
+    GLenum query;
+  };
+
+  static constexpr TargetQuery TEXTURE_TARGETS[] = {
+    { GL_TEXTURE_2D,              GL_TEXTURE_BINDING_2D },
+    { GL_TEXTURE_2D_ARRAY,        GL_TEXTURE_BINDING_2D_ARRAY },
+    { GL_TEXTURE_2D_MULTISAMPLE,  GL_TEXTURE_BINDING_2D_MULTISAMPLE }
+  };
+
+  static constexpr TargetQuery BUFFER_TARGETS[] = {
+    { GL_ARRAY_BUFFER,            GL_ARRAY_BUFFER_BINDING },
+    { GL_DRAW_INDIRECT_BUFFER,    GL_DRAW_INDIRECT_BUFFER_BINDING },
+    { GL_SHADER_STORAGE_BUFFER,   GL_SHADER_STORAGE_BUFFER_BINDING },
+    { GL_UNIFORM_BUFFER,          GL_UNIFORM_BUFFER_BINDING },
+    { GL_PIXEL_PACK_BUFFER,       GL_PIXEL_PACK_BUFFER_BINDING },
+    { GL_PIXEL_UNPACK_BUFFER,     GL_PIXEL_UNPACK_BUFFER_BINDING },
+    { GL_COPY_READ_BUFFER,        GL_COPY_READ_BUFFER_BINDING },
+    { GL_COPY_WRITE_BUFFER,       GL_COPY_WRITE_BUFFER_BINDING }
+  };
+
+  template <Count N>
+  static I32 findTarget (const TargetQuery (&targets)[N], const U32 target)
+  {
+    for (Index i = 0; i < N; ++i) {
+      if (targets[i].target == target) { return static_cast<I32>(i); }
+    }
+
+    return -1;
+  }
+
+  void StateCache::useProgram (const U32 program)
+  {
+    if (s_program == program && validate("program", GL_CURRENT_PROGRAM, program) == true) {
+      return;
+    }
+
+    glUseProgram(program);
+    s_program = program;
+  }
+
+  void StateCache::bindVertexArray (const U32 vertexArray)
+  {
+    if (
+      s_vertexArray == vertexArray &&
+      validate("vertex array", GL_VERTEX_ARRAY_BINDING, vertexArray) == true
+    ) {
+      return;
+    }
+
+    // The element buffer binding belongs to the vertex array, so it is not known after a switch.
+    glBindVertexArray(vertexArray);
+    s_vertexArray = vertexArray;
+    s_elementBuffer = UNKNOWN;
+  }
+
+  void StateCache::bindTexture (const U32 target, const Index unit, const U32 texture)
+  {
+    I32 targetIndex = findTarget(TEXTURE_TARGETS, target);
+    if (targetIndex < 0 || unit >= TEXTURE_UNIT_COUNT_MAX) {
+      glBindTextureUnit(unit, texture);
+      return;
+    }
+
+    // Texture bindings can only be queried on the active texture unit.
+    U32& cached = s_textures[targetIndex][unit];
+    if (cached == texture) {
+      if (s_validating == true && s_activeTextureUnit != unit) {
+        glActiveTexture(GL_TEXTURE0 + unit);
+        s_activeTextureUnit = unit;
+      }
+
+      if (validate("texture", TEXTURE_TARGETS[targetIndex].query, texture) == true) { return; }
+    }
+
+    // Binding a texture straight to its unit does not disturb the active texture unit. Binding
+    // zero unbinds every target of the unit.
+    glBindTextureUnit(unit, texture);
+    if (texture == 0) {
+      for (auto& units : s_textures) { units[unit] = 0; }
+    } else {
+      cached = texture;
+    }
+  }
+
+  void StateCache::bindTexture (const U32 target, const U32 texture)
+  {
+    if (s_activeTextureUnit == UNKNOWN) {
+      glActiveTexture(GL_TEXTURE0);
+      s_activeTextureUnit = 0;
+    }
+
+    I32 targetIndex = findTarget(TEXTURE_TARGETS, target);
+    if (targetIndex < 0 || s_activeTextureUnit >= TEXTURE_UNIT_COUNT_MAX) {
+      glBindTexture(target, texture);
+      return;
+    }
+
+    U32& cached = s_textures[targetIndex][s_activeTextureUnit];
+    GLenum query = TEXTURE_TARGETS[targetIndex].query;
+    if (cached == texture && validate("texture", query, texture) == true) {
+      return;
+    }
+
+    glBindTexture(target, texture);
+    cached = texture;
+  }
+
+  void StateCache::bindBuffer (const U32 target, const U32 buffer)
+  {
+    if (target == GL_ELEMENT_ARRAY_BUFFER) {
+      if (
+        s_elementBuffer == buffer &&
+        validate("element buffer", GL_ELEMENT_ARRAY_BUFFER_BINDING, buffer) == true
+      ) {
+        return;
+      }
+
+      glBindBuffer(target, buffer);
+      s_elementBuffer = buffer;
+      return;
+    }
+
+    I32 targetIndex = findTarget(BUFFER_TARGETS, target);
+    if (targetIndex < 0) {
+      glBindBuffer(target, buffer);
+      return;
+    }
+
+    U32& cached = s_buffers[targetIndex];
+    if (cached == buffer && validate("buffer", BUFFER_TARGETS[targetIndex].query, buffer) == true) {
+      return;
+    }
+
+    glBindBuffer(target, buffer);
+    cached = buffer;
+  }
+
+  void StateCache::bindBufferBase (const U32 target, const U32 index, const U32 buffer)
+  {
+    U32* bindings = nullptr;
+    if (target == GL_UNIFORM_BUFFER) { bindings = s_uniformBuffers; }
+    else if (target == GL_SHADER_STORAGE_BUFFER) { bindings = s_storageBuffers; }
+
+    if (bindings == nullptr || index >= BUFFER_BINDING_COUNT) {
+      glBindBufferBase(target, index, buffer);
+      if (I32 targetIndex = findTarget(BUFFER_TARGETS, target); targetIndex >= 0) {
+        s_buffers[targetIndex] = buffer;
+      }
+
+      return;
+    }
+
+    // Binding to an indexed binding point also binds to its target's generic binding point.
+    I32 targetIndex = findTarget(BUFFER_TARGETS, target);
+    GLenum query = BUFFER_TARGETS[targetIndex].query;
+    if (
+      bindings[index] == buffer && s_buffers[targetIndex] == buffer &&
+      validateIndexed("indexed buffer", query, index, buffer) == true
+    ) {
+      return;
+    }
+
+    glBindBufferBase(target, index, buffer);
+    bindings[index] = buffer;
+    s_buffers[targetIndex] = buffer;
+  }
+
+  void StateCache::bindFrameBuffer (const U32 target, const U32 frameBuffer)
+  {
+    bool draw = (target == GL_FRAMEBUFFER || target == GL_DRAW_FRAMEBUFFER);
+    bool read = (target == GL_FRAMEBUFFER || target == GL_READ_FRAMEBUFFER);
+
+    if (
+      (draw == false || (s_drawFrameBuffer == frameBuffer &&
+        validate("draw framebuffer", GL_DRAW_FRAMEBUFFER_BINDING, frameBuffer) == true)) &&
+      (read == false || (s_readFrameBuffer == frameBuffer &&
+        validate("read framebuffer", GL_READ_FRAMEBUFFER_BINDING, frameBuffer) == true))
+    ) {
+      return;
+    }
+
+    glBindFramebuffer(target, frameBuffer);
+    if (draw == true) { s_drawFrameBuffer = frameBuffer; }
+    if (read == true) { s_readFrameBuffer = frameBuffer; }
+  }
+
+  void StateCache::setViewport (const I32 x, const I32 y, const I32 width, const I32 height)
+  {
+    const I32 viewport[4] = { x, y, width, height };
+    if (std::equal(viewport, viewport + 4, s_viewport) == true) {
+      if (s_validating == false) { s_skippedCallCount++; return; }
+
+      I32 actual[4] = { 0, 0, 0, 0 };
+      glGetIntegerv(GL_VIEWPORT, actual);
+      if (std::equal(viewport, viewport + 4, actual) == true) { s_skippedCallCount++; return; }
+
+      DG_ENGINE_ERROR("GL state cache mismatch on viewport.");
+    }
+
+    glViewport(x, y, width, height);
+    std::copy(viewport, viewport + 4, s_viewport);
+  }
+
+  void StateCache::getViewport (I32 (&viewport)[4])
+  {
+    if (s_viewport[2] < 0 || s_viewport[3] < 0) {
+      glGetIntegerv(GL_VIEWPORT, s_viewport);
+    }
+
+    std::copy(std::begin(s_viewport), std::end(s_viewport), viewport);
+  }
+
+  void StateCache::setClearColor (const Vector4f& color)
+  {
+    const F32 clearColor[4] = { color.x, color.y, color.z, color.w };
+    const F32 cached[4] = { s_clearColor.x, s_clearColor.y, s_clearColor.z, s_clearColor.w };
+    if (std::equal(clearColor, clearColor + 4, cached) == true) {
+      if (s_validating == false) { s_skippedCallCount++; return; }
+
+      F32 actual[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+      glGetFloatv(GL_COLOR_CLEAR_VALUE, actual);
+      if (std::equal(clearColor, clearColor + 4, actual) == true) {
+        s_skippedCallCount++;
+        return;
+      }
+
+      DG_ENGINE_ERROR("GL state cache mismatch on clear color.");
+    }
+
+    glClearColor(color.x, color.y, color.z, color.w);
+    s_clearColor = color;
+  }
+
+  void StateCache::deleteVertexArray (const U32 vertexArray)
+  {
+    // Deleting a bound object reverts its bindings in the current context to zero.
+    glDeleteVertexArrays(1, &vertexArray);
+    if (s_vertexArray == vertexArray) {
+      s_vertexArray = 0;
+      s_elementBuffer = UNKNOWN;
+    }
+  }
+
+  void StateCache::deleteTexture (const U32 texture)
+  {
+    glDeleteTextures(1, &texture);
+    for (auto& units : s_textures) {
+      std::replace(std::begin(units), std::end(units), texture, 0u);
+    }
+  }
+
+  void StateCache::deleteBuffer (const U32 buffer)
+  {
+    glDeleteBuffers(1, &buffer);
+    if (s_elementBuffer == buffer) { s_elementBuffer = 0; }
+    std::replace(std::begin(s_buffers), std::end(s_buffers), buffer, 0u);
+    std::replace(std::begin(s_uniformBuffers), std::end(s_uniformBuffers), buffer, 0u);
+    std::replace(std::begin(s_storageBuffers), std::end(s_storageBuffers), buffer, 0u);
+  }
+
+  void StateCache::deleteFrameBuffer (const U32 frameBuffer)
+  {
+    glDeleteFramebuffers(1, &frameBuffer);
+    if (s_drawFrameBuffer == frameBuffer) { s_drawFrameBuffer = 0; }
+    if (s_readFrameBuffer == frameBuffer) { s_readFrameBuffer = 0; }
+  }
+
+  void StateCache::invalidate ()
+  {
+    s_program = UNKNOWN;
+    s_vertexArray = UNKNOWN;
+    s_elementBuffer = UNKNOWN;
+    s_activeTextureUnit = UNKNOWN;
+    for (auto& units : s_textures) {
+      std::fill(std::begin(units), std::end(units), UNKNOWN);
+    }
+
+    std::fill(std::begin(s_buffers), std::end(s_buffers), UNKNOWN);
+    std::fill(std::begin(s_uniformBuffers), std::end(s_uniformBuffers), UNKNOWN);
+    std::fill(std::begin(s_storageBuffers), std::end(s_storageBuffers), UNKNOWN);
+    s_drawFrameBuffer = UNKNOWN;
+    s_readFrameBuffer = UNKNOWN;
+    std::fill(std::begin(s_viewport), std::end(s_viewport), -1);
+
+    // No clear color compares equal to NaN.
+    F32 nan = std::numeric_limits<F32>::quiet_NaN();
+    s_clearColor = { nan, nan, nan, nan };
+  }
+
+  bool StateCache::validate (const Char* name, const U32 query, const U32 expected)
+  {
+    if (s_validating == true) {
+      I32 actual = 0;
+      glGetIntegerv(query, &actual);
+      if (static_cast<U32>(actual) != expected) {
+        DG_ENGINE_ERROR("GL state cache mismatch on {} (cached {}; actually {}).", name,
+          expected, actual);
+        return false;
+      }
+    }
+
+    s_skippedCallCount++;
+    return true;
+  }
+
+  bool StateCache::validateIndexed (const Char* name, const U32 query, const U32 index,
+    const U32 expected)
+  {
+    if (s_validating == true) {
+      I32 actual = 0;
+      glGetIntegeri_v(query, index, &actual);
+      if (static_cast<U32>(actual) != expected) {
+        DG_ENGINE_ERROR("GL state cache mismatch on {} {} (cached {}; actually {}).", name,
+          index, expected, actual);
+        return false;
+      }
+    }
+
+    s_skippedCallCount++;
+    return true;
+  }
+
+}
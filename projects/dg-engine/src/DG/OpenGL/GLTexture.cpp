@@ -1,6 +1,8 @@
 /** @file DG/OpenGL/GLTexture.cpp */
 
+#include <DG/OpenGL/GLGraphicsBuffers.hpp>
 #include <DG/OpenGL/GLTexture.hpp>
+#include <DG/OpenGL/GLStateCache.hpp>
 
 namespace dg
 {
@@ -15,6 +17,11 @@ namespace dg
     return std::make_shared<OpenGL::TextureImpl>(path);
   }
 
+  Shared<TextureArray> TextureArray::make (const TextureArraySpecification& spec)
+  {
+    return std::make_shared<OpenGL::TextureArrayImpl>(spec);
+  }
+
 }
 
 namespace dg::OpenGL
@@ -64,34 +71,36 @@ namespace dg::OpenGL
     Texture { spec }
   {
     glGenTextures(1, &m_handle);
-    initializeTexture();
+    m_valid = initializeTexture();
+    if (m_valid == true) {
+      glTexImage2D(GL_TEXTURE_2D, 0, m_internalFormat, m_size.x, m_size.y, 0, m_pixelFormat,
+        GL_UNSIGNED_BYTE, nullptr);
+    }
   }
 
   TextureImpl::~TextureImpl ()
   {
-    glDeleteTextures(1, &m_handle);
+    StateCache::deleteTexture(m_handle);
   }
 
   void TextureImpl::bind (const Index slot) const
   {
-    if (slot >= TEXTURE_SLOT_COUNT) {
+    if (slot >= TEXTURE_UNIT_COUNT_MAX) {
       DG_ENGINE_THROW(std::invalid_argument,
         "Attempt to bind texture to invalid slot number {}!", slot);
     }  
 
-    glActiveTexture(GL_TEXTURE0 + slot);
-    glBindTexture(GL_TEXTURE_2D, m_handle);
+    StateCache::bindTexture(GL_TEXTURE_2D, slot, m_handle);
   }
 
   void TextureImpl::unbind (const Index slot) const
   {
-    if (slot >= TEXTURE_SLOT_COUNT) {
+    if (slot >= TEXTURE_UNIT_COUNT_MAX) {
       DG_ENGINE_THROW(std::invalid_argument,
         "Attempt to unbind texture from invalid slot number {}!", slot);
     }
 
-    glActiveTexture(GL_TEXTURE0 + slot);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    StateCache::bindTexture(GL_TEXTURE_2D, slot, 0);
   }
 
   void TextureImpl::upload (const void* data, const Size size)
@@ -108,9 +117,90 @@ namespace dg::OpenGL
           expectedSize, size);
     }
 
-    glBindTexture(GL_TEXTURE_2D, m_handle);
+    StateCache::bindTexture(GL_TEXTURE_2D, m_handle);
     glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, m_size.x, m_size.y, m_pixelFormat, GL_UNSIGNED_BYTE,
       data);
+    m_revision++;
+  }
+
+  void TextureImpl::uploadRegion (const Vector2i& offset, const Vector2i& size, const void* data,
+    const Size dataSize)
+  {
+    if (data == nullptr || dataSize == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to upload null data or zero size to GL texture region!");
+    }
+
+    if (
+      offset.x < 0 || offset.y < 0 || size.x <= 0 || size.y <= 0 ||
+      offset.x + size.x > m_size.x || offset.y + size.y > m_size.y
+    ) {
+      DG_ENGINE_THROW(std::out_of_range,
+        "Attempt to upload to out of range GL texture region!");
+    }
+
+    Size expectedSize = (size.x * size.y * m_colorChannelCount);
+    if (dataSize != expectedSize) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to upload data of mismatched size to GL texture region (expected {} bytes; got {} instead)!",
+          expectedSize, dataSize);
+    }
+
+    // Rows of a region narrower than the texture need not be four-byte aligned.
+    StateCache::bindTexture(GL_TEXTURE_2D, m_handle);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, offset.x, offset.y, size.x, size.y, m_pixelFormat,
+      GL_UNSIGNED_BYTE, data);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    m_revision++;
+  }
+
+  void TextureImpl::uploadRegion (const Vector2i& offset, const Vector2i& size,
+    const PixelUploadBuffer& buffer, const Size bufferOffset)
+  {
+    if (buffer.isRegionAcquired() == false) {
+      DG_ENGINE_THROW(std::runtime_error,
+        "Attempt to upload to GL texture region from unacquired pixel upload buffer region!");
+    }
+
+    if (
+      offset.x < 0 || offset.y < 0 || size.x <= 0 || size.y <= 0 ||
+      offset.x + size.x > m_size.x || offset.y + size.y > m_size.y
+    ) {
+      DG_ENGINE_THROW(std::out_of_range,
+        "Attempt to upload to out of range GL texture region!");
+    }
+
+    Size dataSize = (size.x * size.y * m_colorChannelCount);
+    if (bufferOffset + dataSize > buffer.getRegionSize()) {
+      DG_ENGINE_THROW(std::out_of_range,
+        "Attempt to upload {} bytes at offset {} from GL pixel upload buffer region of {} bytes!",
+          dataSize, bufferOffset, buffer.getRegionSize());
+    }
+
+    // With a pixel unpack buffer bound, the data pointer is an offset into that buffer, and the
+    // transfer is left to the graphics card. The buffer is unbound again straight away, since every
+    // other upload passes a pointer into client memory.
+    U32 bufferHandle = static_cast<const PixelUploadBufferImpl&>(buffer).getHandle();
+    const void* bufferData = (const void*) (intptr_t) (buffer.getRegionOffset() + bufferOffset);
+
+    StateCache::bindBuffer(GL_PIXEL_UNPACK_BUFFER, bufferHandle);
+    StateCache::bindTexture(GL_TEXTURE_2D, m_handle);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, offset.x, offset.y, size.x, size.y, m_pixelFormat,
+      GL_UNSIGNED_BYTE, bufferData);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    StateCache::bindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    m_revision++;
+  }
+
+  void TextureImpl::swapStorage (Texture& other)
+  {
+    auto& texture = static_cast<TextureImpl&>(other);
+    std::swap(m_handle, texture.m_handle);
+    std::swap(m_internalFormat, texture.m_internalFormat);
+    std::swap(m_pixelFormat, texture.m_pixelFormat);
+    swapProperties(other);
   }
 
   void* TextureImpl::getPointer () const
@@ -125,7 +215,7 @@ namespace dg::OpenGL
       return false;
     }
 
-    glBindTexture(GL_TEXTURE_2D, m_handle);
+    StateCache::bindTexture(GL_TEXTURE_2D, m_handle);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, resolveTextureWrap(m_wrap));
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, resolveTextureWrap(m_wrap));
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, resolveTextureFilter(m_minify));
@@ -150,4 +240,136 @@ namespace dg::OpenGL
     return true;
   }
 
+
+
+  TextureArrayImpl::TextureArrayImpl (const TextureArraySpecification& spec) :
+    TextureArray { spec }
+  {
+    if (resolveTextureFormat(m_colorChannelCount, m_internalFormat, m_pixelFormat) == false) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to create GL texture array with invalid color channel count {}!",
+          m_colorChannelCount);
+    }
+
+    if (m_size.x <= 0 || m_size.y <= 0 || m_layerCount == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to create GL texture array with zero size or no layers!");
+    }
+
+    m_handle = allocate(m_layerCount);
+  }
+
+  TextureArrayImpl::~TextureArrayImpl ()
+  {
+    StateCache::deleteTexture(m_handle);
+  }
+
+  void TextureArrayImpl::bind (const Index slot) const
+  {
+    if (slot >= TEXTURE_UNIT_COUNT_MAX) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to bind texture array to invalid slot number {}!", slot);
+    }  
+
+    StateCache::bindTexture(GL_TEXTURE_2D_ARRAY, slot, m_handle);
+  }
+
+  void TextureArrayImpl::unbind (const Index slot) const
+  {
+    if (slot >= TEXTURE_UNIT_COUNT_MAX) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to unbind texture array from invalid slot number {}!", slot);
+    }
+
+    StateCache::bindTexture(GL_TEXTURE_2D_ARRAY, slot, 0);
+  }
+
+  void TextureArrayImpl::uploadLayer (const U32 layer, const void* data, const Size size)
+  {
+    if (data == nullptr || size == 0) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to upload null data or zero size to GL texture array!");
+    }
+
+    if (layer >= m_layerCount) {
+      DG_ENGINE_THROW(std::out_of_range,
+        "Attempt to upload to out of range GL texture array layer {}!", layer);
+    }
+
+    Size expectedSize = (m_size.x * m_size.y * m_colorChannelCount);
+    if (size != expectedSize) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to upload data of mismatched size to GL texture array (expected {} bytes; got {} instead)!",
+          expectedSize, size);
+    }
+
+    StateCache::bindTexture(GL_TEXTURE_2D_ARRAY, m_handle);
+    glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, layer, m_size.x, m_size.y, 1, m_pixelFormat,
+      GL_UNSIGNED_BYTE, data);
+  }
+
+  void TextureArrayImpl::copyLayer (const U32 layer, const Texture& texture)
+  {
+    if (layer >= m_layerCount) {
+      DG_ENGINE_THROW(std::out_of_range,
+        "Attempt to copy to out of range GL texture array layer {}!", layer);
+    }
+
+    if (texture.isValid() == false || isCompatible(texture) == false) {
+      DG_ENGINE_THROW(std::invalid_argument,
+        "Attempt to copy invalid or incompatible texture into GL texture array!");
+    }
+
+    // The copy happens entirely on the graphics card; no pixel data passes through client memory.
+    glCopyImageSubData(
+      static_cast<const TextureImpl&>(texture).getHandle(), GL_TEXTURE_2D, 0, 0, 0, 0,
+      m_handle, GL_TEXTURE_2D_ARRAY, 0, 0, 0, layer,
+      m_size.x, m_size.y, 1
+    );
+  }
+
+  void TextureArrayImpl::reserve (const U32 layerCount)
+  {
+    if (layerCount <= m_layerCount) { return; }
+
+    // The limit cannot change while the context lives, so it is only queried once.
+    static const I32 maxLayerCount = [] {
+      I32 count = 0;
+      glGetIntegerv(GL_MAX_ARRAY_TEXTURE_LAYERS, &count);
+      return count;
+    }();
+
+    if (layerCount > static_cast<U32>(maxLayerCount)) {
+      DG_ENGINE_THROW(std::out_of_range,
+        "Attempt to grow GL texture array past {} layers (max is {})!", layerCount,
+          maxLayerCount);
+    }
+
+    U32 handle = allocate(layerCount);
+    glCopyImageSubData(
+      m_handle, GL_TEXTURE_2D_ARRAY, 0, 0, 0, 0,
+      handle, GL_TEXTURE_2D_ARRAY, 0, 0, 0, 0,
+      m_size.x, m_size.y, m_layerCount
+    );
+
+    StateCache::deleteTexture(m_handle);
+    m_handle = handle;
+    m_layerCount = layerCount;
+  }
+
+  U32 TextureArrayImpl::allocate (const U32 layerCount)
+  {
+    U32 handle = 0;
+    glGenTextures(1, &handle);
+    StateCache::bindTexture(GL_TEXTURE_2D_ARRAY, handle);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, resolveTextureWrap(m_wrap));
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, resolveTextureWrap(m_wrap));
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, resolveTextureFilter(m_minify));
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, resolveTextureFilter(m_magnify));
+    glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, m_internalFormat, m_size.x, m_size.y, layerCount, 0,
+      m_pixelFormat, GL_UNSIGNED_BYTE, nullptr);
+
+    return handle;
+  }
+
 }
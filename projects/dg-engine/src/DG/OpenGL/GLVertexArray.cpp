@@ -1,6 +1,7 @@
 /** @file DG/OpenGL/GLVertexArray.cpp */
 
 #include <DG/OpenGL/GLVertexArray.hpp>
+#include <DG/OpenGL/GLStateCache.hpp>
 
 namespace dg
 {
@@ -43,6 +44,9 @@ namespace dg::OpenGL
       case VertexAttributeType::Double3x3: return GL_DOUBLE;          
       case VertexAttributeType::Float4x4:  return GL_FLOAT;         
       case VertexAttributeType::Double4x4: return GL_DOUBLE; 
+      case VertexAttributeType::Ushort2:   return GL_UNSIGNED_SHORT;
+      case VertexAttributeType::Ushort4:   return GL_UNSIGNED_SHORT;
+      case VertexAttributeType::Ubyte4:    return GL_UNSIGNED_BYTE;
       default: return 0;        
     }
   }
@@ -55,17 +59,17 @@ namespace dg::OpenGL
 
   VertexArrayImpl::~VertexArrayImpl ()
   {
-    glDeleteVertexArrays(1, &m_handle);
+    StateCache::deleteVertexArray(m_handle);
   }
 
   void VertexArrayImpl::bind () const
   {
-    glBindVertexArray(m_handle);
+    StateCache::bindVertexArray(m_handle);
   }
 
   void VertexArrayImpl::unbind () const
   {
-    glBindVertexArray(0);
+    StateCache::bindVertexArray(0);
   }
 
   void VertexArrayImpl::addVertexBuffer (const Shared<VertexBuffer>& vbo)
@@ -81,28 +85,35 @@ namespace dg::OpenGL
         "Attempt to add vertex buffer with no layout to GL vertex array!");
     }
 
-    if (isLayoutDefined() == true) {
-      const auto& firstLayout = m_vbos.at(0)->getLayout();
-      if (layout.isCompatible(firstLayout) == false) {
-        DG_ENGINE_THROW(std::invalid_argument,
-          "Attempt to add vertex buffer with incompatible layout to GL vertex array!");
-      }
-    }
-
-    glBindVertexArray(m_handle);
+    StateCache::bindVertexArray(m_handle);
     vbo->bind();
 
-    Index index = 0;
+    // Each vertex buffer's attributes are assigned the attribute locations following those of the
+    // buffers added before it, so per-vertex and per-instance buffers can share one vertex array.
+    // Integer attributes must go through the integer pointer function; otherwise, the GL converts
+    // their values to floats before they reach the shader.
     for (const auto& attribute : layout) {
-      glVertexAttribPointer(
-        index,
-        attribute.getElementCount(),
-        resolveGLType(attribute.type),
-        attribute.normalized ? GL_TRUE : GL_FALSE,
-        layout.getStride(),
-        (const void*) attribute.offset
-      );
-      glEnableVertexAttribArray(index++);
+      if (attribute.isInteger() == true) {
+        glVertexAttribIPointer(
+          m_attributeCount,
+          attribute.getElementCount(),
+          resolveGLType(attribute.type),
+          layout.getStride(),
+          (const void*) attribute.offset
+        );
+      } else {
+        glVertexAttribPointer(
+          m_attributeCount,
+          attribute.getElementCount(),
+          resolveGLType(attribute.type),
+          attribute.normalized ? GL_TRUE : GL_FALSE,
+          layout.getStride(),
+          (const void*) attribute.offset
+        );
+      }
+
+      glVertexAttribDivisor(m_attributeCount, attribute.divisor);
+      glEnableVertexAttribArray(m_attributeCount++);
     }
 
     m_vbos.push_back(vbo);
@@ -115,7 +126,7 @@ namespace dg::OpenGL
         "Attempt to assign null index buffer to GL vertex array!");
     }
 
-    glBindVertexArray(m_handle);
+    StateCache::bindVertexArray(m_handle);
     ibo->bind();
 
     m_ibo = ibo;
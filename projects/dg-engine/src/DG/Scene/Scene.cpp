@@ -7,6 +7,43 @@
 namespace dg
 {
 
+  static bool isQuadVisible (const Matrix4f& cameraProduct, const Matrix4f& transform)
+  {
+    // Carry the quad's center and half-axes into clip space. Each corner is the center plus or
+    // minus each half-axis, so the corner nearest to the inside of a clipping plane (-w <= x <= w,
+    // and so on) is found by subtracting the half-axes' absolute distances from that plane. The quad
+    // is culled if even that corner is outside some plane.
+    Vector4f center = cameraProduct * Vector4f { transform.da, transform.db, transform.dc, 1.0f };
+    Vector4f halfX = cameraProduct * Vector4f {
+      transform.aa * 0.5f, transform.ab * 0.5f, transform.ac * 0.5f, 0.0f };
+    Vector4f halfY = cameraProduct * Vector4f {
+      transform.ba * 0.5f, transform.bb * 0.5f, transform.bc * 0.5f, 0.0f };
+
+    auto isOutside = [&] (F32 (*distance) (const Vector4f&)) {
+      return distance(center) - std::abs(distance(halfX)) - std::abs(distance(halfY)) > 0.0f;
+    };
+
+    return !(
+      isOutside([] (const Vector4f& v) { return v.x - v.w; }) ||
+      isOutside([] (const Vector4f& v) { return -v.x - v.w; }) ||
+      isOutside([] (const Vector4f& v) { return v.y - v.w; }) ||
+      isOutside([] (const Vector4f& v) { return -v.y - v.w; }) ||
+      isOutside([] (const Vector4f& v) { return v.z - v.w; }) ||
+      isOutside([] (const Vector4f& v) { return -v.z - v.w; })
+    );
+  }
+
+  static RenderSpecification2D makeQuadSpec (entt::entity entity, const QuadComponent& quad)
+  {
+    return RenderSpecification2D {
+      .color = quad.color,
+      .texture = quad.texture,
+      .entityId = static_cast<I32>(entity),
+      .texRect = quad.texRect,
+      .layer = quad.layer
+    };
+  }
+
   Scene::Scene () :
     m_registry {}
   {
@@ -15,6 +52,7 @@ namespace dg
 
   Scene::~Scene ()
   {
+    setRetainedRenderingEnabled(false);
     m_registry.clear();
   }
 
@@ -59,18 +97,160 @@ namespace dg
 
     Renderer& renderer = Application::getRenderer();
     renderer.beginScene2D(cameraProduct);
-    {
+    if (m_retainedEnabled == true) {
+      syncRetainedQuads(renderer);
+      renderer.drawRetainedQuads2D();
+      m_visibleQuadCount = m_retainedQuads.size();
+      m_culledQuadCount = 0;
+    } else {
+      submitQuads(renderer, cameraProduct);
+    }
+    renderer.endScene2D();
+  }
+
+  void Scene::setRetainedRenderingEnabled (bool enabled)
+  {
+    if (enabled == m_retainedEnabled) { return; }
+
+    // Quads are added or updated as the observer collects them, and removed as either of their
+    // components is destroyed; the observer forgets entities whose components are destroyed.
+    if (enabled == true) {
+      m_quadObserver.connect(m_registry, entt::collector
+        .group<TransformComponent, QuadComponent>()
+        .update<TransformComponent>().where<QuadComponent>()
+        .update<QuadComponent>().where<TransformComponent>());
+      m_registry.on_destroy<TransformComponent>().connect<&Scene::onQuadDestroyed>(*this);
+      m_registry.on_destroy<QuadComponent>().connect<&Scene::onQuadDestroyed>(*this);
+      m_retainedResync = true;
+    } else {
+      m_registry.on_destroy<TransformComponent>().disconnect<&Scene::onQuadDestroyed>(*this);
+      m_registry.on_destroy<QuadComponent>().disconnect<&Scene::onQuadDestroyed>(*this);
+      m_quadObserver.disconnect();
+      m_quadObserver.clear();
+      releaseRetainedQuads();
+    }
+
+    m_retainedEnabled = enabled;
+  }
+
+  void Scene::submitQuads (Renderer& renderer, const Matrix4f& cameraProduct)
+  {
+    auto view = m_registry.view<TransformComponent, QuadComponent>();
+    m_visibleQuadCount = 0;
+    m_culledQuadCount = 0;
+
+    if (view.size_hint() < PARALLEL_QUAD_THRESHOLD) {
+      for (const auto& entity : view) {
+        const auto& [transform, quad] = view.get<TransformComponent, QuadComponent>(entity);
+        if (
+          m_cullingEnabled == true &&
+          isQuadVisible(cameraProduct, transform.transform) == false
+        ) {
+          m_culledQuadCount++;
+          continue;
+        }
+
+        renderer.submitQuad2D(transform.transform, makeQuadSpec(entity, quad));
+        m_visibleQuadCount++;
+      }
+
+      return;
+    }
+
+    // Gather the entities first, so that they can be split into contiguous chunks; each chunk is
+    // recorded into its own recorder, and the recorders are merged in chunk order, so the quads
+    // reach the renderer in the same order as they would have on the main thread.
+    m_quadEntities.clear();
+    for (const auto& entity : view) {
+      m_quadEntities.push_back(entity);
+    }
+
+    ThreadPool& threadPool = Application::getThreadPool();
+    Count chunkCount = threadPool.getThreadCount() + 1;
+    renderer.reserveQuadRecorders2D(chunkCount);
+    threadPool.parallelFor(m_quadEntities.size(), [&] (Index begin, Index end, Index chunk) {
+      QuadRecorder2D& recorder = renderer.getQuadRecorder2D(chunk);
+      for (Index i = begin; i < end; ++i) {
+        entt::entity entity = m_quadEntities[i];
+        const auto& [transform, quad] = view.get<TransformComponent, QuadComponent>(entity);
+        if (
+          m_cullingEnabled == false ||
+          isQuadVisible(cameraProduct, transform.transform) == true
+        ) {
+          recorder.submitQuad2D(transform.transform, makeQuadSpec(entity, quad));
+        }
+      }
+    }, chunkCount);
+
+    // Whatever was recorded is visible; the rest was culled.
+    for (Index i = 0; i < chunkCount; ++i) {
+      m_visibleQuadCount += renderer.getQuadRecorder2D(i).getQuadCount();
+    }
+    m_culledQuadCount = m_quadEntities.size() - m_visibleQuadCount;
+
+    renderer.mergeQuadRecorders2D();
+  }
+
+  void Scene::syncRetainedQuads (Renderer& renderer)
+  {
+    // If the renderer's retained quad buffer was cleared since the last sync, this scene's handles
+    // are gone with it, and every quad must be added again.
+    if (m_retainedResync == true || m_retainedGeneration != renderer.getRetainedGeneration2D()) {
+      releaseRetainedQuads();
+
       auto view = m_registry.view<TransformComponent, QuadComponent>();
       for (const auto& entity : view) {
         const auto& [transform, quad] = view.get<TransformComponent, QuadComponent>(entity);
-        renderer.submitQuad2D(transform.transform, RenderSpecification2D {
-          .color = quad.color,
-          .texture = quad.texture,
-          .entityId = static_cast<I32>(entity)
-        });
+        m_retainedQuads[entity] = renderer.addRetainedQuad2D(transform.transform,
+          makeQuadSpec(entity, quad));
       }
+
+      m_quadObserver.clear();
+      m_retainedGeneration = renderer.getRetainedGeneration2D();
+      m_retainedResync = false;
+      return;
+    }
+
+    for (const auto& handle : m_removedRetainedQuads) {
+      renderer.removeRetainedQuad2D(handle);
+    }
+    m_removedRetainedQuads.clear();
+
+    m_quadObserver.each([&] (entt::entity entity) {
+      const auto& [transform, quad] = m_registry.get<TransformComponent, QuadComponent>(entity);
+      RenderSpecification2D spec = makeQuadSpec(entity, quad);
+      if (auto iter = m_retainedQuads.find(entity); iter != m_retainedQuads.end()) {
+        renderer.updateRetainedQuad2D(iter->second, transform.transform, spec);
+      } else {
+        m_retainedQuads[entity] = renderer.addRetainedQuad2D(transform.transform, spec);
+      }
+    });
+  }
+
+  void Scene::releaseRetainedQuads ()
+  {
+    // Handles from before the renderer's retained quad buffer was last cleared are already gone.
+    Renderer& renderer = Application::getRenderer();
+    if (m_retainedGeneration == renderer.getRetainedGeneration2D()) {
+      for (const auto& [entity, handle] : m_retainedQuads) {
+        renderer.removeRetainedQuad2D(handle);
+      }
+
+      for (const auto& handle : m_removedRetainedQuads) {
+        renderer.removeRetainedQuad2D(handle);
+      }
+    }
+
+    m_retainedQuads.clear();
+    m_removedRetainedQuads.clear();
+  }
+
+  void Scene::onQuadDestroyed (entt::registry&, entt::entity entity)
+  {
+    if (auto iter = m_retainedQuads.find(entity); iter != m_retainedQuads.end()) {
+      m_removedRetainedQuads.push_back(iter->second);
+      m_retainedQuads.erase(iter);
     }
-    renderer.endScene2D();
   }
 
   void Scene::findPrimaryCameraMatrix (Matrix4f& cameraProduct)
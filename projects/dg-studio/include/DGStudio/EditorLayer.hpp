@@ -34,6 +34,7 @@ namespace dgstudio
   private:
     bool  m_showDemoWindow        = true;
     bool  m_showSceneWindow       = true;
+    bool  m_dynamicResolution     = false;
 
   };
 
@@ -14,10 +14,12 @@ namespace dgstudio
       dg::FrameBufferTextureFormat::COLOR_R32I,
       dg::FrameBufferTextureFormat::DEPTH
     };
+    framebufferSpec.resizePolicy = { .bucketSize = 128, .shrinkDelay = 120 };
 
     m_frameBuffer = dg::FrameBuffer::make(framebufferSpec);
-    m_shader = dg::Shader::make("assets/quad2d.glsl");
-    m_texture = dg::Texture::make("assets/wall.jpg");
+    dg::AssetCache& assetCache = dg::Application::getAssetCache();
+    m_shader = assetCache.getShader("assets/quad2d.glsl");
+    m_texture = assetCache.getTexture("assets/wall.jpg");
 
     dg::Renderer& renderer = dg::Application::getRenderer();
     renderer.useFrameBuffer2D(m_frameBuffer);
@@ -68,6 +70,14 @@ namespace dgstudio
     if (ImGui::BeginMenu("View")) {
       ImGui::MenuItem("Scene Window", nullptr, &m_showSceneWindow);
       ImGui::MenuItem("ImGui Demo Window", nullptr, &m_showDemoWindow);
+      ImGui::Separator();
+
+      // Dynamic resolution also lowers the resolution of the entity ID attachment used for
+      // picking, so it is left to the user to turn on.
+      if (ImGui::MenuItem("Dynamic Resolution", nullptr, &m_dynamicResolution)) {
+        dg::Application::getRenderer().setDynamicResolutionEnabled2D(m_dynamicResolution);
+      }
+
       ImGui::EndMenu();
     }
   }
@@ -88,9 +98,15 @@ namespace dgstudio
     ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, { 0.0f, 0.0f });
 
     ImGui::Begin("Scene", &m_showSceneWindow);
+    // The scene was drawn at the framebuffer's size before this resize, so that is the region of
+    // its color attachment shown. Only if the attachments were rebuilt is there nothing to show.
     ImVec2 contentRegionAvailable = ImGui::GetContentRegionAvail();
-    if (m_frameBuffer->setSize(contentRegionAvailable.x, contentRegionAvailable.y) == false) {
-      ImGui::Image(m_frameBuffer->getColorPointer(), contentRegionAvailable, { 0, 1 }, { 1, 0 });
+    dg::Vector2u allocatedSize = m_frameBuffer->getAllocatedSize();
+    dg::Vector2f texCoordScale = m_frameBuffer->getTexCoordScale();
+    m_frameBuffer->setSize(contentRegionAvailable.x, contentRegionAvailable.y);
+    if (m_frameBuffer->getAllocatedSize() == allocatedSize) {
+      ImGui::Image(m_frameBuffer->getColorPointer(), contentRegionAvailable,
+        { 0, texCoordScale.y }, { texCoordScale.x, 0 });
     }
     ImGui::End();
 